@@ -0,0 +1,137 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Memory placement benchmark of the large typed batches.
+//!
+//! @details Worker threads propagate their slice of a batch of typed
+//! covariances `P = F * P * F^T + Q`, hundreds of megabytes in total. The batches are
+//! allocated by the default allocator from the main thread, by the huge page
+//! allocator from the main thread, and by the node-local allocator from each
+//! worker thread. Run the built executable on a multi-socket Linux machine to
+//! print the updates per second of each placement. The node-local placement
+//! avoids the cross-socket traffic, the huge pages the translation misses.
+
+#include "fcarouge/linalg.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace fcarouge::benchmark {
+namespace {
+using state = matrix<double, 6, 6>;
+
+inline constexpr std::size_t size{1'000'000};
+
+inline constexpr std::size_t repetitions{10};
+
+volatile double sink{0.0};
+
+//! @brief Prints the updates per second of the batch of the allocator.
+//!
+//! @details The slices are allocated and filled from the worker threads when
+//! local, from the main thread otherwise.
+template <typename Allocator>
+void measure(std::string_view name, bool local) {
+  const std::size_t workers{std::max(std::thread::hardware_concurrency(), 1U)};
+  const std::size_t slice{size / workers};
+  std::vector<std::vector<state, Allocator>> batches(workers);
+  state transition{identity<state>()};
+  const state noise{0.001 * state{identity<state>()}};
+
+  transition(0, 1) = 0.01;
+
+  auto fill{[&batches, slice](std::size_t worker) {
+    batches[worker].assign(slice, identity<state>());
+  }};
+
+  if (!local) {
+    for (std::size_t worker{0}; worker < workers; ++worker) {
+      fill(worker);
+    }
+  }
+
+  std::vector<std::chrono::steady_clock::duration> elapsed(workers);
+  std::vector<std::thread> threads;
+
+  for (std::size_t worker{0}; worker < workers; ++worker) {
+    threads.emplace_back([&, worker] {
+      if (local) {
+        fill(worker);
+      }
+
+      const auto start{std::chrono::steady_clock::now()};
+
+      for (std::size_t repetition{0}; repetition < repetitions; ++repetition) {
+        for (state &covariance : batches[worker]) {
+          covariance = transition * covariance * transpose(transition) + noise;
+        }
+      }
+
+      elapsed[worker] = std::chrono::steady_clock::now() - start;
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  sink = sink + batches[0][0](0, 0);
+
+  const std::chrono::duration<double> slowest{
+      *std::max_element(elapsed.begin(), elapsed.end())};
+  const double updates{static_cast<double>(slice * workers * repetitions)};
+
+  std::fputs(std::format("{} with {} workers: {:.0f} updates/s\n", name,
+                         workers, updates / slowest.count())
+                 .c_str(),
+             stdout);
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() {
+  using namespace fcarouge;
+  using namespace fcarouge::benchmark;
+
+  measure<std::allocator<state>>("default allocator", false);
+  measure<huge_page_allocator<state>>("huge page allocator", false);
+  measure<node_local_allocator<state>>("node-local allocator", true);
+
+  return 0;
+}
@@ -0,0 +1,109 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Binary size benchmark of the distinct typings of the same storages.
+//!
+//! @details The same prediction is compiled through as many distinct index
+//! types as configured, each typing in its own function kept out of line by the
+//! table of their addresses. The index types are checked at compile time and
+//! forward the arithmetic to the shared evaluation kernels of the storages.
+//! Compare the total `.text` size of the objects of many typings and of a
+//! single typing, for example with `size`: the growth per typing is the size of
+//! one typed prediction. The kernels may be inlined in each prediction, unless
+//! they are declared by the explicit instantiation library.
+
+#include "fcarouge/linalg.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_BENCHMARK_TYPINGS
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_BENCHMARK_TYPINGS 64
+#endif
+
+namespace fcarouge::benchmark {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+//! @brief The count of distinct typings.
+inline constexpr std::size_t typings{
+    FCAROUGE_TYPED_LINEAR_ALGEBRA_BENCHMARK_TYPINGS};
+
+//! @brief A distinct index type per typing.
+template <std::size_t Tag> struct index {
+  double value;
+
+  [[nodiscard]] friend inline constexpr double operator*(index lhs,
+                                                         index rhs) {
+    return lhs.value * rhs.value;
+  }
+
+  [[nodiscard]] friend inline constexpr double operator/(int lhs, index rhs) {
+    return lhs / rhs.value;
+  }
+};
+
+//! @brief The typed transition of the given typing.
+template <std::size_t Tag>
+using transition =
+    typed_matrix<eigen::matrix<double, 4, 4>, tla::tuple_n_type<index<Tag>, 4>,
+                 tla::tuple_n_type<index<Tag>, 4>>;
+
+//! @brief The typed state of the given typing.
+template <std::size_t Tag>
+using state =
+    typed_matrix<eigen::matrix<double, 4, 1>, tla::tuple_n_type<index<Tag>, 4>,
+                 tla::identity_index>;
+
+//! @brief The prediction through the given typing.
+template <std::size_t Tag>
+void predict(const eigen::matrix<double, 4, 4> &f,
+             eigen::matrix<double, 4, 1> &x) {
+  x = (transition<Tag>{f} * state<Tag>{x} * 0.5).data;
+}
+
+//! @brief The type of the predictions.
+using prediction = void (*)(const eigen::matrix<double, 4, 4> &,
+                            eigen::matrix<double, 4, 1> &);
+} // namespace
+
+//! @brief The predictions of each typing.
+//!
+//! @details The escaping addresses keep one out-of-line function per typing.
+extern const std::array<prediction, typings> predictions;
+
+const std::array<prediction, typings> predictions{
+    []<std::size_t... Tags>(std::index_sequence<Tags...>) {
+      return std::array<prediction, typings>{&predict<Tags>...};
+    }(std::make_index_sequence<typings>{})};
+} // namespace fcarouge::benchmark
@@ -0,0 +1,145 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Contention benchmark of the typed matrix hand-off.
+//!
+//! @details A writer thread publishes a typed state while reader threads load
+//! it, for a mutex-guarded typed matrix and for the lock-free typed channel.
+//! Run the built executable to print the publications and loads per second and
+//! the worst publication time of the writer, for each count of readers.
+
+#include "fcarouge/linalg.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <format>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace fcarouge::benchmark {
+namespace {
+using state = matrix<double, 6, 6>;
+
+inline constexpr std::chrono::milliseconds duration{500};
+
+volatile double sink{0.0};
+
+//! @brief A typed state guarded by a mutex.
+class guarded {
+public:
+  void store(const state &value) {
+    const std::lock_guard lock{mutex};
+    data = value;
+  }
+
+  [[nodiscard]] state load() const {
+    const std::lock_guard lock{mutex};
+    return data;
+  }
+
+private:
+  mutable std::mutex mutex;
+  state data{};
+};
+
+//! @brief Prints the throughputs and the worst publication time of the
+//! hand-off with the count of readers.
+template <typename Handoff>
+void measure(std::string_view name, std::size_t readers) {
+  Handoff handoff;
+  std::atomic<bool> done{false};
+  std::atomic<std::uint64_t> loads{0};
+  std::vector<std::thread> threads;
+
+  for (std::size_t reader{0}; reader < readers; ++reader) {
+    threads.emplace_back([&handoff, &done, &loads] {
+      std::uint64_t count{0};
+
+      while (!done.load(std::memory_order_relaxed)) {
+        sink = sink + handoff.load()(0, 0);
+        ++count;
+      }
+
+      loads.fetch_add(count, std::memory_order_relaxed);
+    });
+  }
+
+  state value{};
+  std::uint64_t stores{0};
+  std::chrono::nanoseconds worst{0};
+  const auto start{std::chrono::steady_clock::now()};
+
+  while (std::chrono::steady_clock::now() - start < duration) {
+    value(0, 0) += 1.0;
+
+    const auto before{std::chrono::steady_clock::now()};
+
+    handoff.store(value);
+    worst = std::max(worst, std::chrono::steady_clock::now() - before);
+    ++stores;
+  }
+
+  done.store(true, std::memory_order_relaxed);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  const std::chrono::duration<double> elapsed{duration};
+
+  std::fputs(std::format("{} with {} readers: {:.0f} stores/s, {:.0f} loads/s, "
+                         "{} ns worst store\n",
+                         name, readers, stores / elapsed.count(),
+                         loads.load() / elapsed.count(), worst.count())
+                 .c_str(),
+             stdout);
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() {
+  using namespace fcarouge;
+  using namespace fcarouge::benchmark;
+
+  for (std::size_t readers : {1, 2, 4, 8}) {
+    measure<guarded>("mutex", readers);
+    measure<typed_channel<state>>("channel", readers);
+  }
+
+  return 0;
+}
@@ -0,0 +1,61 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Compile-time benchmark of the typed linear algebra named module.
+//!
+//! @details The same translation unit as the header benchmark, importing the
+//! module.
+
+import fcarouge.linalg.eigen;
+
+namespace fcarouge::benchmark {
+//! @brief A representative prediction of a filter.
+matrix<double, 4, 4> predict(const matrix<double, 4, 4> &estimate,
+                             const matrix<double, 4, 4> &transition,
+                             const matrix<double, 4, 4> &noise) {
+  return transition * estimate * transpose(transition) + noise;
+}
+
+//! @brief A representative update of a filter.
+matrix<double, 4, 2> gain(const matrix<double, 4, 4> &estimate,
+                          const matrix<double, 2, 4> &observation,
+                          const matrix<double, 2, 2> &noise) {
+  return estimate * transpose(observation) /
+         (observation * estimate * transpose(observation) + noise);
+}
+
+//! @brief A representative diagonal noise scaling.
+matrix<double, 4, 4> scale(const diagonal_matrix<double, 4> &factor,
+                           const matrix<double, 4, 4> &noise) {
+  return factor * noise * factor;
+}
+} // namespace fcarouge::benchmark
@@ -0,0 +1,80 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Code generation benchmark of the typed matrix constructors.
+//!
+//! @details Each typed construction is paired with its Eigen comma initializer
+//! equivalent. Disassemble the object of the translation unit, for example
+//! with `objdump -d`, to compare the instructions of each pair. The optimized
+//! constructions are expected to be the same sequences of stores.
+
+#include "fcarouge/linalg.hpp"
+
+namespace fcarouge::benchmark {
+//! @brief A column vector constructed from its variadic values.
+column_vector<double, 4> typed_column(double x, double y, double z, double w) {
+  return column_vector<double, 4>{x, y, z, w};
+}
+
+//! @brief The Eigen comma initializer equivalent of the column vector.
+Eigen::Vector<double, 4> eigen_column(double x, double y, double z, double w) {
+  Eigen::Vector<double, 4> result;
+  result << x, y, z, w;
+  return result;
+}
+
+//! @brief A row vector constructed from its variadic values.
+matrix<double, 1, 4> typed_row(double x, double y, double z, double w) {
+  return matrix<double, 1, 4>{x, y, z, w};
+}
+
+//! @brief The Eigen comma initializer equivalent of the row vector.
+Eigen::RowVector<double, 4> eigen_row(double x, double y, double z, double w) {
+  Eigen::RowVector<double, 4> result;
+  result << x, y, z, w;
+  return result;
+}
+
+//! @brief A matrix constructed from a nested array.
+matrix<double, 3, 3> typed_nested(const double (&elements)[3][3]) {
+  return matrix<double, 3, 3>{elements};
+}
+
+//! @brief The Eigen comma initializer equivalent of the nested array.
+Eigen::Matrix<double, 3, 3> eigen_nested(const double (&elements)[3][3]) {
+  Eigen::Matrix<double, 3, 3> result;
+  result << elements[0][0], elements[0][1], elements[0][2], elements[1][0],
+      elements[1][1], elements[1][2], elements[2][0], elements[2][1],
+      elements[2][2];
+  return result;
+}
+} // namespace fcarouge::benchmark
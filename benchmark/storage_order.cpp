@@ -0,0 +1,116 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Run-time benchmark of the storage orders of the typed matrices.
+//!
+//! @details Times the row by row traversal and the product of matrices of each
+//! storage order. Run the built executable to print the elapsed time per
+//! iteration of each case.
+
+#include "fcarouge/linalg.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <string_view>
+
+namespace fcarouge::benchmark {
+namespace {
+inline constexpr std::size_t size{64};
+inline constexpr std::size_t iterations{2000};
+
+volatile double sink{0.0};
+
+//! @brief Prints the elapsed time per iteration of the function.
+template <typename Function>
+void measure(std::string_view name, Function function) {
+  const auto start{std::chrono::steady_clock::now()};
+
+  for (std::size_t iteration{0}; iteration < iterations; ++iteration) {
+    sink = sink + function();
+  }
+
+  const std::chrono::duration<double, std::nano> elapsed{
+      std::chrono::steady_clock::now() - start};
+
+  std::fputs(std::format("{}: {:.0f} ns\n", name,
+                         elapsed.count() / static_cast<double>(iterations))
+                 .c_str(),
+             stdout);
+}
+
+//! @brief The sum of the elements, traversed row by row.
+template <typename Matrix> double traverse(const Matrix &value) {
+  double result{0.0};
+
+  for (std::size_t i{0}; i < size; ++i) {
+    for (std::size_t j{0}; j < size; ++j) {
+      result += value(i, j);
+    }
+  }
+
+  return result;
+}
+
+template <storage_order Order> matrix<double, size, size, Order> make() {
+  matrix<double, size, size, Order> result;
+
+  for (std::size_t i{0}; i < size; ++i) {
+    for (std::size_t j{0}; j < size; ++j) {
+      result(i, j) = static_cast<double>(i * size + j) / (size * size);
+    }
+  }
+
+  return result;
+}
+} // namespace
+} // namespace fcarouge::benchmark
+
+int main() {
+  using namespace fcarouge;
+  using namespace fcarouge::benchmark;
+
+  const auto column{make<storage_order::column_major>()};
+  const auto row{make<storage_order::row_major>()};
+
+  measure("column-major row traversal", [&column] { return traverse(column); });
+  measure("row-major row traversal", [&row] { return traverse(row); });
+  measure("column-major product",
+          [&column] { return (column * column)(0, 0); });
+  measure("row-major product", [&row] { return (row * row)(0, 0); });
+  measure("mixed-order product", [&row, &column] {
+    return (row * column)(0, 0);
+  });
+
+  return 0;
+}
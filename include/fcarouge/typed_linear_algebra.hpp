@@ -38,14 +38,30 @@ For more information, please refer to <https://unlicense.org> */
 //! @details Typed matrix, vectors, and operations.
 
 #include "typed_linear_algebra_forward.hpp"
+#include "typed_linear_algebra_internal/allocator.hpp"
+#include "typed_linear_algebra_internal/differentiation.hpp"
+#include "typed_linear_algebra_internal/exponential.hpp"
+#include "typed_linear_algebra_internal/factorization.hpp"
 #include "typed_linear_algebra_internal/format.hpp"
+#include "typed_linear_algebra_internal/health.hpp"
+#include "typed_linear_algebra_internal/instrumentation.hpp"
 #include "typed_linear_algebra_internal/utility.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cmath>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <format>
 #include <initializer_list>
+#include <memory>
+#include <optional>
+#include <ranges>
 #include <tuple>
+#include <utility>
 
 namespace fcarouge {
 
@@ -93,6 +109,18 @@ public:
   //! @todo Can this be removed altogether?
   explicit inline constexpr typed_matrix(const Matrix &other) : data{other} {}
 
+  //! @brief Writes the values straight into the storage, in order.
+  //!
+  //! @details The pack expansion compiles to a sequence of stores without an
+  //! intermediate copy of the values nor a loop.
+  template <std::size_t... Indexes, typename... Types>
+  inline constexpr void assign(std::index_sequence<Indexes...>,
+                               const Types &...values) {
+    ((data(std::size_t{Indexes}) =
+          tla::element_traits<underlying, Types>::to_underlying(values)),
+     ...);
+  }
+
   //! @}
 
   //! @name Private Member Variables
@@ -159,14 +187,44 @@ public:
     data(0, 0) = tla::element_traits<underlying, Type>::to_underlying(value);
   }
 
-  //! @todo Verify the list sizes at runtime?
+  //! @details The nested compile-time sized arrays are written straight into
+  //! the storage, row by row.
+  inline constexpr explicit typed_matrix(
+      const element<0, 0> (&elements)[tla::size<RowIndexes>]
+                                     [tla::size<ColumnIndexes>])
+    requires tla::uniform<typed_matrix>
+  {
+    [this, &elements]<std::size_t... Indexes>(
+        std::index_sequence<Indexes...>) {
+      ((data(std::size_t{Indexes / columns}, std::size_t{Indexes % columns}) =
+            tla::element_traits<underlying, element<0, 0>>::to_underlying(
+                elements[Indexes / columns][Indexes % columns])),
+       ...);
+    }(std::make_index_sequence<rows * columns>{});
+  }
+
+  //! @details The lists must be of the sizes of the matrix. Mismatching lists
+  //! fail constant evaluations and debug builds. Otherwise, the values beyond
+  //! the sizes of the matrix are ignored.
   template <typename Type>
   inline constexpr explicit typed_matrix(
       std::initializer_list<std::initializer_list<Type>> row_list)
     requires tla::uniform<typed_matrix>
   {
+    assert(row_list.size() == rows && "The count of rows must match.");
+
     for (std::size_t i{0}; const auto &row : row_list) {
+      assert(row.size() == columns && "The count of columns must match.");
+
+      if (i == rows) {
+        break;
+      }
+
       for (std::size_t j{0}; const auto &value : row) {
+        if (j == columns) {
+          break;
+        }
+
         data(i, j) =
             tla::element_traits<underlying, Type>::to_underlying(value);
         ++j;
@@ -177,33 +235,18 @@ public:
 
   //! @todo Combine the two constructors in ome?
   //! @todo Verify if the types are the same, or assignable, for nicer error?
-  //! @todo Rewrite with a fold expression over the pack?
   template <typename... Types>
     requires tla::row<typed_matrix> && (not tla::column<typed_matrix>) &&
              tla::same_size<ColumnIndexes, std::tuple<Types...>>
   explicit inline constexpr typed_matrix(const Types &...values) {
-    std::tuple value_pack{values...};
-    tla::for_constexpr<0, tla::size<ColumnIndexes>, 1>(
-        [this, &value_pack](auto position) {
-          auto value{std::get<position>(value_pack)};
-          using type = std::remove_cvref_t<decltype(value)>;
-          data[position] =
-              tla::element_traits<underlying, type>::to_underlying(value);
-        });
+    assign(std::index_sequence_for<Types...>{}, values...);
   }
 
   template <typename... Types>
     requires tla::column<typed_matrix> && (not tla::row<typed_matrix>) &&
              tla::same_size<RowIndexes, std::tuple<Types...>>
   inline constexpr typed_matrix(const Types &...values) {
-    std::tuple value_pack{values...};
-    tla::for_constexpr<0, tla::size<RowIndexes>, 1>(
-        [this, &value_pack](auto position) {
-          auto value{std::get<position>(value_pack)};
-          using type = std::remove_cvref_t<decltype(value)>;
-          data[position] =
-              tla::element_traits<underlying, type>::to_underlying(value);
-        });
+    assign(std::index_sequence_for<Types...>{}, values...);
   }
 
   [[nodiscard]] inline constexpr explicit(false) operator element<0, 0> &()
@@ -249,6 +292,14 @@ public:
         from_underlying(data(std::size_t{Row}, std::size_t{Column}));
   }
 
+  template <std::size_t Row, std::size_t Column>
+    requires tla::in_range<Row, 0, tla::size<RowIndexes>> &&
+             tla::in_range<Column, 0, tla::size<ColumnIndexes>>
+  [[nodiscard]] inline constexpr const element<Row, Column> &at() const {
+    return tla::element_traits<underlying, element<Row, Column>>::
+        from_underlying(data(std::size_t{Row}, std::size_t{Column}));
+  }
+
   template <std::size_t Index>
     requires tla::column<typed_matrix> &&
              tla::in_range<Index, 0, tla::size<RowIndexes>>
@@ -257,6 +308,14 @@ public:
         data(std::size_t{Index}));
   }
 
+  template <std::size_t Index>
+    requires tla::column<typed_matrix> &&
+             tla::in_range<Index, 0, tla::size<RowIndexes>>
+  [[nodiscard]] inline constexpr const element<Index, 0> &at() const {
+    return tla::element_traits<underlying, element<Index, 0>>::from_underlying(
+        data(std::size_t{Index}));
+  }
+
   //! @}
 };
 
@@ -270,6 +329,1251 @@ template <typename Matrix, typename... RowIndexes>
 using typed_column_vector =
     typed_matrix<Matrix, std::tuple<RowIndexes...>, tla::identity_index>;
 
+//! @brief Compile-time identity matrix.
+//!
+//! @details A storage-free tag standing for the identity of the typed matrix.
+//! The operators simplify the expressions involving the identity at compile
+//! time. The tag converts to the dense typed matrix on demand. The identity is
+//! square: the simplifications relabel the other operand with its indexes.
+//!
+//! @tparam TypedMatrix The square typed matrix of the identity.
+template <typename TypedMatrix> struct identity_matrix {
+  static_assert(tla::typed_matrix<TypedMatrix>);
+  static_assert(tla::same_size<typename TypedMatrix::row_indexes,
+                               typename TypedMatrix::column_indexes>,
+                "The identity matrix must be square.");
+
+  //! @brief The dense typed matrix of the identity.
+  using type = TypedMatrix;
+
+  [[nodiscard]] inline constexpr explicit(false) operator TypedMatrix() const {
+    using underlying = typename TypedMatrix::underlying;
+    TypedMatrix result;
+
+    for (std::size_t i{0}; i < TypedMatrix::rows; ++i) {
+      for (std::size_t j{0}; j < TypedMatrix::columns; ++j) {
+        result.data(i, j) = i == j ? underlying{1} : underlying{0};
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Compile-time zero matrix.
+//!
+//! @details A storage-free tag standing for the null typed matrix. The
+//! operators simplify the expressions involving the zero at compile time. The
+//! tag converts to the dense typed matrix on demand.
+//!
+//! @tparam TypedMatrix The typed matrix of the zero.
+template <typename TypedMatrix> struct zero_matrix {
+  static_assert(tla::typed_matrix<TypedMatrix>);
+
+  //! @brief The dense typed matrix of the zero.
+  using type = TypedMatrix;
+
+  [[nodiscard]] inline constexpr explicit(false) operator TypedMatrix() const {
+    using underlying = typename TypedMatrix::underlying;
+    TypedMatrix result;
+
+    for (std::size_t i{0}; i < TypedMatrix::rows; ++i) {
+      for (std::size_t j{0}; j < TypedMatrix::columns; ++j) {
+        result.data(i, j) = underlying{0};
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief The direction of the concatenation of typed matrices.
+enum class stacking {
+  //! @brief Side by side, the column indexes are concatenated.
+  horizontal,
+  //! @brief On top of each other, the row indexes are concatenated.
+  vertical
+};
+
+//! @brief Lazy concatenation of typed matrices.
+//!
+//! @details An expression standing for the concatenation of the typed pieces.
+//! The index types of the pieces are concatenated at compile time. Each piece
+//! is written once, straight into the single destination storage. The
+//! expression refers to the pieces, evaluate it before the pieces expire.
+//!
+//! @tparam Direction The direction of the concatenation.
+//! @tparam Pieces The typed matrices to concatenate.
+template <stacking Direction, typename... Pieces> struct typed_stack {
+  static_assert(sizeof...(Pieces) > 0);
+  static_assert((tla::typed_matrix<Pieces> && ...));
+
+private:
+  using first = std::tuple_element_t<0, std::tuple<Pieces...>>;
+
+public:
+  //! @brief The dense typed matrix of the concatenation.
+  using type = std::conditional_t<
+      Direction == stacking::vertical,
+      typed_matrix<tla::resize<tla::evaluate<decltype(first::data)>,
+                               (Pieces::rows + ...), first::columns>,
+                   tla::concatenate<typename Pieces::row_indexes...>,
+                   typename first::column_indexes>,
+      typed_matrix<tla::resize<tla::evaluate<decltype(first::data)>,
+                               first::rows, (Pieces::columns + ...)>,
+                   typename first::row_indexes,
+                   tla::concatenate<typename Pieces::column_indexes...>>>;
+
+  static_assert(
+      Direction == stacking::vertical
+          ? (std::is_same_v<typename Pieces::column_indexes,
+                            typename first::column_indexes> &&
+             ...)
+          : (std::is_same_v<typename Pieces::row_indexes,
+                            typename first::row_indexes> &&
+             ...),
+      "The stacked pieces must share the indexes along the stacking.");
+
+  //! @brief The referred pieces.
+  std::tuple<const Pieces &...> pieces;
+
+  //! @brief Writes the pieces into the destination.
+  inline constexpr void assign_to(type &destination) const {
+    std::apply(
+        [&destination](const auto &...piece) {
+          std::size_t offset{0};
+
+          ((write(destination, piece, offset),
+            offset += Direction == stacking::vertical
+                          ? std::remove_cvref_t<decltype(piece)>::rows
+                          : std::remove_cvref_t<decltype(piece)>::columns),
+           ...);
+        },
+        pieces);
+  }
+
+  [[nodiscard]] inline constexpr explicit(false) operator type() const {
+    type result;
+
+    assign_to(result);
+
+    return result;
+  }
+
+private:
+  template <typename Piece>
+  static inline constexpr void write(type &destination, const Piece &piece,
+                                     std::size_t offset) {
+    for (std::size_t i{0}; i < Piece::rows; ++i) {
+      for (std::size_t j{0}; j < Piece::columns; ++j) {
+        if constexpr (Direction == stacking::vertical) {
+          destination.data(offset + i, j) = piece.data(i, j);
+        } else {
+          destination.data(i, offset + j) = piece.data(i, j);
+        }
+      }
+    }
+  }
+};
+
+//! @brief Lazy Kronecker product of typed matrices.
+//!
+//! @details An expression standing for the Kronecker product `kron(A, B)` of
+//! the typed matrices. The indexes of the product are the pairwise products of
+//! the indexes of the operands. The products of the expression with typed
+//! matrices are evaluated as `kron(A, B) * vec(X) = vec(B * X * A^T)` column by
+//! column, without materializing the large product. The expression refers to
+//! the operands, evaluate it before the operands expire.
+//!
+//! @tparam Lhs The typed matrix `A` of the left hand side.
+//! @tparam Rhs The typed matrix `B` of the right hand side.
+template <typename Lhs, typename Rhs> struct typed_kronecker {
+  static_assert(tla::typed_matrix<Lhs> && tla::typed_matrix<Rhs>);
+
+  //! @brief The tuple with the row components of the indexes.
+  using row_indexes = tla::kronecker_indexes<typename Lhs::row_indexes,
+                                             typename Rhs::row_indexes>;
+
+  //! @brief The tuple with the column components of the indexes.
+  using column_indexes = tla::kronecker_indexes<typename Lhs::column_indexes,
+                                                typename Rhs::column_indexes>;
+
+  //! @brief The dense typed matrix of the product.
+  using type = typed_matrix<tla::resize<tla::evaluate<decltype(Lhs::data)>,
+                                        Lhs::rows * Rhs::rows,
+                                        Lhs::columns * Rhs::columns>,
+                            row_indexes, column_indexes>;
+
+  //! @brief The count of rows.
+  inline constexpr static std::size_t rows{tla::size<row_indexes>};
+
+  //! @brief The count of columns.
+  inline constexpr static std::size_t columns{tla::size<column_indexes>};
+
+  //! @brief The referred left hand side.
+  const Lhs &lhs;
+
+  //! @brief The referred right hand side.
+  const Rhs &rhs;
+
+  //! @brief Writes the products of the elements into the destination.
+  inline constexpr void assign_to(type &destination) const {
+    for (std::size_t j{0}; j < Lhs::columns; ++j) {
+      for (std::size_t l{0}; l < Rhs::columns; ++l) {
+        for (std::size_t i{0}; i < Lhs::rows; ++i) {
+          for (std::size_t k{0}; k < Rhs::rows; ++k) {
+            destination.data(i * Rhs::rows + k, j * Rhs::columns + l) =
+                lhs.data(i, j) * rhs.data(k, l);
+          }
+        }
+      }
+    }
+  }
+
+  [[nodiscard]] inline constexpr explicit(false) operator type() const {
+    type result;
+
+    assign_to(result);
+
+    return result;
+  }
+};
+
+//! @brief Strongly typed diagonal matrix.
+//!
+//! @details Compose a linear algebra backend column vector into a typed square
+//! diagonal matrix. Only the diagonal elements are stored. The diagonal element
+//! at position `i` is of the product type of the row and column indexes at
+//! position `i`. Products with dense typed matrices are row or column scalings,
+//! inversion and division are linear in the size of the operands.
+//!
+//! @tparam Vector The underlying linear algebra column vector of the diagonal.
+//! @tparam RowIndexes The packed types of the row indexes.
+//! @tparam ColumnIndexes The packed types of the column indexes.
+template <typename Vector, typename RowIndexes, typename ColumnIndexes>
+struct typed_diagonal_matrix {
+  static_assert(tla::algebraic<Vector>);
+  static_assert(tla::same_size<RowIndexes, ColumnIndexes>);
+  //! @todo Privatize this section.
+public:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The type of the element's underlying storage.
+  using underlying = tla::underlying_t<Vector>;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  explicit inline constexpr typed_diagonal_matrix(const Vector &other)
+      : data{other} {}
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  Vector data;
+
+  //! @}
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The tuple with the row components of the indexes.
+  using row_indexes = RowIndexes;
+
+  //! @brief The tuple with the column components of the indexes.
+  using column_indexes = ColumnIndexes;
+
+  //! @brief The type of the element at the given matrix indexes position.
+  template <std::size_t RowIndex, std::size_t ColumnIndex>
+  using element = tla::element<typed_diagonal_matrix, RowIndex, ColumnIndex>;
+
+  //! @brief The dense typed matrix equivalent to the diagonal matrix.
+  using dense = typed_matrix<
+      tla::evaluate<tla::product<Vector, tla::transpose<Vector>>>, RowIndexes,
+      ColumnIndexes>;
+
+  //! @}
+
+  //! @name Public Member Variables
+  //! @{
+
+  //! @brief The count of rows.
+  inline constexpr static std::size_t rows{tla::size<row_indexes>};
+
+  //! @brief The count of columns.
+  inline constexpr static std::size_t columns{tla::size<column_indexes>};
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  inline constexpr typed_diagonal_matrix() = default;
+
+  inline constexpr typed_diagonal_matrix(const typed_diagonal_matrix &other) =
+      default;
+
+  inline constexpr typed_diagonal_matrix &
+  operator=(const typed_diagonal_matrix &other) = default;
+
+  inline constexpr typed_diagonal_matrix(typed_diagonal_matrix &&other) =
+      default;
+
+  inline constexpr typed_diagonal_matrix &
+  operator=(typed_diagonal_matrix &&other) = default;
+
+  //! @brief Construct from the diagonal elements, in order.
+  template <typename... Types>
+    requires tla::same_size<RowIndexes, std::tuple<Types...>>
+  explicit inline constexpr typed_diagonal_matrix(const Types &...values) {
+    [this, &values...]<std::size_t... Indexes>(
+        std::index_sequence<Indexes...>) {
+      ((data(Indexes) =
+            tla::element_traits<underlying, Types>::to_underlying(values)),
+       ...);
+    }(std::make_index_sequence<sizeof...(Types)>{});
+  }
+
+  //! @brief Convert to the dense typed matrix.
+  [[nodiscard]] inline constexpr explicit(false) operator dense() const {
+    dense result;
+
+    for (std::size_t j{0}; j < columns; ++j) {
+      for (std::size_t i{0}; i < rows; ++i) {
+        result.data(i, j) = i == j ? data(i) : underlying{0};
+      }
+    }
+
+    return result;
+  }
+
+  //! @brief The typed diagonal element at the given position.
+  template <std::size_t Index>
+    requires tla::in_range<Index, 0, tla::size<RowIndexes> - 1>
+  [[nodiscard]] inline constexpr element<Index, Index> &at() {
+    return tla::element_traits<underlying, element<Index, Index>>::
+        from_underlying(data(std::size_t{Index}));
+  }
+
+  //! @brief The constant typed diagonal element at the given position.
+  template <std::size_t Index>
+    requires tla::in_range<Index, 0, tla::size<RowIndexes> - 1>
+  [[nodiscard]] inline constexpr const element<Index, Index> &at() const {
+    return tla::element_traits<underlying, element<Index, Index>>::
+        from_underlying(data(std::size_t{Index}));
+  }
+
+  //! @}
+};
+
+//! @brief The triangular part of a matrix.
+enum class triangle {
+  //! @brief The lower triangle, below and on the diagonal.
+  lower,
+  //! @brief The upper triangle, above and on the diagonal.
+  upper
+};
+
+//! @brief The storage order of the elements of a matrix.
+//!
+//! @details A backend storage policy. Traversals along the storage order read
+//! memory contiguously.
+enum class storage_order {
+  //! @brief The elements of a column are contiguous.
+  column_major,
+  //! @brief The elements of a row are contiguous.
+  row_major
+};
+
+//! @brief Strongly typed triangular factor.
+//!
+//! @details The triangular Cholesky factor of a symmetric positive definite
+//! typed matrix. The factor keeps the row and column indexes of the factored
+//! typed matrix through updates and propagations. A lower factor `L` factors
+//! the matrix `L * L^T`, an upper factor `U` factors the matrix `U^T * U`. The
+//! factor supports rank-one updates, triangular solutions, and square-root
+//! propagation without re-factorization.
+//!
+//! @tparam Matrix The underlying linear algebra square matrix.
+//! @tparam RowIndexes The packed types of the row indexes of the factored
+//! matrix.
+//! @tparam ColumnIndexes The packed types of the column indexes of the
+//! factored matrix.
+//! @tparam Part The stored triangle of the factor.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes,
+          triangle Part = triangle::lower>
+struct typed_triangular_factor {
+  static_assert(tla::algebraic<Matrix>);
+  static_assert(tla::same_size<RowIndexes, ColumnIndexes>);
+  //! @todo Privatize this section.
+public:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The type of the element's underlying storage.
+  using underlying = tla::underlying_t<Matrix>;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  explicit inline constexpr typed_triangular_factor(const Matrix &other)
+      : data{other} {}
+
+  //! @brief The element accessor of the lower triangular matrix `L` of the
+  //! factorization `L * L^T`.
+  [[nodiscard]] inline constexpr auto lower() {
+    return tla::accessor<Part == triangle::upper>(data);
+  }
+
+  //! @brief The element accessor of the lower triangular matrix `L` of the
+  //! factorization `L * L^T`.
+  [[nodiscard]] inline constexpr auto lower() const {
+    return tla::accessor<Part == triangle::upper>(data);
+  }
+
+  //! @brief The element accessor of the upper triangular matrix `U` of the
+  //! factorization `U^T * U`.
+  [[nodiscard]] inline constexpr auto upper() const {
+    return tla::accessor<Part == triangle::lower>(data);
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  Matrix data;
+
+  //! @}
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The tuple with the row components of the indexes.
+  using row_indexes = RowIndexes;
+
+  //! @brief The tuple with the column components of the indexes.
+  using column_indexes = ColumnIndexes;
+
+  //! @}
+
+  //! @name Public Member Variables
+  //! @{
+
+  //! @brief The count of rows.
+  inline constexpr static std::size_t rows{tla::size<row_indexes>};
+
+  //! @brief The count of columns.
+  inline constexpr static std::size_t columns{tla::size<column_indexes>};
+
+  //! @brief The stored triangle.
+  inline constexpr static triangle part{Part};
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  inline constexpr typed_triangular_factor() = default;
+
+  inline constexpr typed_triangular_factor(
+      const typed_triangular_factor &other) = default;
+
+  inline constexpr typed_triangular_factor &
+  operator=(const typed_triangular_factor &other) = default;
+
+  inline constexpr typed_triangular_factor(typed_triangular_factor &&other) =
+      default;
+
+  inline constexpr typed_triangular_factor &
+  operator=(typed_triangular_factor &&other) = default;
+
+  //! @brief Rank-one update, or downdate, of the factor.
+  //!
+  //! @details Updates the factor of the typed matrix `P` to the factor of the
+  //! typed matrix `P + sigma * v * v^T` in `O(n^2)` operations, without
+  //! re-factorization. A negative sigma downdates the factor.
+  //!
+  //! @return False if the downdated matrix is not positive definite, the factor
+  //! is then left in an unspecified state.
+  template <typename Vector, typename Indexes>
+    requires(tla::size<Indexes> == 1)
+  [[nodiscard]] inline constexpr bool
+  rank_update(const typed_matrix<Vector, RowIndexes, Indexes> &vector,
+              underlying sigma = underlying{1}) {
+    std::array<underlying, rows> work;
+
+    for (std::size_t i{0}; i < rows; ++i) {
+      work[i] = vector.data(i, 0);
+    }
+
+    return tla::rank_update<underlying, rows>(lower(), work, sigma);
+  }
+
+  //! @}
+};
+
+//! @brief Strongly typed block diagonal matrix.
+//!
+//! @details Compose typed square blocks into a typed square block diagonal
+//! matrix. Only the blocks are stored, the off-diagonal blocks are zero. Each
+//! block keeps its own row and column indexes, the indexes of the matrix are
+//! their concatenation. The products, divisions, inversions, factorizations and
+//! solutions operate block by block: their cost scales with the sum of the
+//! cubes of the block sizes rather than with the cube of their sum.
+//!
+//! @tparam Blocks The typed square blocks, typed matrices or typed triangular
+//! factors, in order along the diagonal.
+template <typename... Blocks> struct typed_block_diagonal_matrix {
+  static_assert(sizeof...(Blocks) > 0);
+  static_assert((tla::typed_matrix<Blocks> && ...));
+  static_assert(((Blocks::rows == Blocks::columns) && ...),
+                "The blocks of a block diagonal matrix must be square.");
+
+private:
+  using first = std::tuple_element_t<0, std::tuple<Blocks...>>;
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The tuple with the row components of the indexes.
+  using row_indexes = tla::concatenate<typename Blocks::row_indexes...>;
+
+  //! @brief The tuple with the column components of the indexes.
+  using column_indexes = tla::concatenate<typename Blocks::column_indexes...>;
+
+  //! @brief The type of the block at the given position.
+  template <std::size_t Index>
+  using block_type = std::tuple_element_t<Index, std::tuple<Blocks...>>;
+
+  //! @brief The dense typed matrix equivalent to the block diagonal matrix.
+  using dense =
+      typed_matrix<tla::resize<tla::evaluate<decltype(first::data)>,
+                               (Blocks::rows + ...), (Blocks::columns + ...)>,
+                   row_indexes, column_indexes>;
+
+  //! @}
+
+  //! @name Public Member Variables
+  //! @{
+
+  //! @brief The count of rows.
+  inline constexpr static std::size_t rows{tla::size<row_indexes>};
+
+  //! @brief The count of columns.
+  inline constexpr static std::size_t columns{tla::size<column_indexes>};
+
+  //! @brief The position of the first row and column of each block.
+  inline constexpr static std::array<std::size_t, sizeof...(Blocks)> offsets{
+      [] {
+        std::array<std::size_t, sizeof...(Blocks)> result{};
+        std::size_t index{0};
+        std::size_t offset{0};
+
+        ((result[index++] = offset, offset += Blocks::rows), ...);
+
+        return result;
+      }()};
+
+  //! @brief The typed blocks, in order along the diagonal.
+  std::tuple<Blocks...> blocks;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  inline constexpr typed_block_diagonal_matrix() = default;
+
+  inline constexpr typed_block_diagonal_matrix(
+      const typed_block_diagonal_matrix &other) = default;
+
+  inline constexpr typed_block_diagonal_matrix &
+  operator=(const typed_block_diagonal_matrix &other) = default;
+
+  inline constexpr typed_block_diagonal_matrix(
+      typed_block_diagonal_matrix &&other) = default;
+
+  inline constexpr typed_block_diagonal_matrix &
+  operator=(typed_block_diagonal_matrix &&other) = default;
+
+  //! @brief Construct from the blocks, in order along the diagonal.
+  explicit inline constexpr typed_block_diagonal_matrix(
+      const Blocks &...values)
+      : blocks{values...} {}
+
+  //! @brief Convert to the dense typed matrix.
+  //!
+  //! @details The blocks are typed matrices. The off-diagonal blocks are
+  //! written zero.
+  [[nodiscard]] inline constexpr explicit(false) operator dense() const
+    requires(std::is_same_v<Blocks,
+                            typed_matrix<decltype(Blocks::data),
+                                         typename Blocks::row_indexes,
+                                         typename Blocks::column_indexes>> &&
+             ...)
+  {
+    using underlying = typename dense::underlying;
+    dense result;
+
+    for (std::size_t j{0}; j < columns; ++j) {
+      for (std::size_t i{0}; i < rows; ++i) {
+        result.data(i, j) = underlying{0};
+      }
+    }
+
+    for_each_block([&result](const auto &value, std::size_t offset) {
+      using block = std::remove_cvref_t<decltype(value)>;
+
+      tla::place<block::rows, block::columns>(result.data, value.data, offset,
+                                              offset);
+    });
+
+    return result;
+  }
+
+  //! @brief The typed block at the given position.
+  template <std::size_t Index>
+    requires tla::in_range<Index, 0, sizeof...(Blocks) - 1>
+  [[nodiscard]] inline constexpr block_type<Index> &block() {
+    return std::get<Index>(blocks);
+  }
+
+  //! @brief The constant typed block at the given position.
+  template <std::size_t Index>
+    requires tla::in_range<Index, 0, sizeof...(Blocks) - 1>
+  [[nodiscard]] inline constexpr const block_type<Index> &block() const {
+    return std::get<Index>(blocks);
+  }
+
+  //! @brief Visits each block, in order, with the position of its first row
+  //! and column.
+  template <typename Visitor>
+  inline constexpr void for_each_block(Visitor &&visitor) const {
+    [this, &visitor]<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+      (visitor(std::get<Indexes>(blocks), offsets[Indexes]), ...);
+    }(std::index_sequence_for<Blocks...>{});
+  }
+
+  //! @}
+};
+
+//! @brief Least recently used cache of discretizations per time step.
+//!
+//! @details Irregular sample intervals repeat. The discretizations of the
+//! continuous-time model are memoized by their exact time step in a fixed
+//! capacity storage, the least recently used discretization is evicted first.
+//! The model is fixed at construction. No allocation occurs.
+//!
+//! @tparam Drift The typed drift matrix `A` of the model.
+//! @tparam Input The typed noise input matrix `G` of the model.
+//! @tparam Density The typed noise spectral density matrix `Qc` of the model.
+//! @tparam Capacity The count of memoized time steps.
+template <typename Drift, typename Input, typename Density,
+          std::size_t Capacity = 8>
+class discretization_cache {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the time step.
+  using step = typename Drift::underlying;
+
+  //! @brief The pair of the transition `F` and of the covariance `Q`.
+  using result = decltype(discretize(std::declval<const Drift &>(),
+                                     std::declval<const Input &>(),
+                                     std::declval<const Density &>(), step{}));
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  inline constexpr discretization_cache(const Drift &drift, const Input &input,
+                                        const Density &density)
+      : a{drift}, g{input}, qc{density} {}
+
+  //! @brief The discretization of the model over the time step.
+  //!
+  //! @details The reference is valid until the discretization is evicted.
+  [[nodiscard]] inline constexpr const result &operator()(step dt) {
+    entry *oldest{&entries.front()};
+
+    for (auto &cached : entries) {
+      if (cached.used != 0 && cached.dt == dt) {
+        cached.used = ++clock;
+        return cached.value;
+      }
+
+      if (cached.used < oldest->used) {
+        oldest = &cached;
+      }
+    }
+
+    *oldest = {dt, ++clock, discretize(a, g, qc, dt)};
+
+    return oldest->value;
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief A memoized discretization and its last use, zero if unused.
+  struct entry {
+    step dt{};
+    std::uint64_t used{0};
+    result value{};
+  };
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  Drift a;
+  Input g;
+  Density qc;
+  std::array<entry, Capacity> entries{};
+  std::uint64_t clock{0};
+
+  //! @}
+};
+
+//! @brief Scaled unscented transform.
+//!
+//! @details The parameters and weights of the `2 * Size + 1` sigma points of
+//! the scaled unscented transform of a state of `Size` elements. The spread of
+//! the sigma points about the mean is `sqrt(Size + lambda)` columns of the
+//! square root of the covariance, with `lambda = alpha^2 * (Size + kappa) -
+//! Size`.
+//!
+//! @tparam Type The type of the parameters and weights.
+//! @tparam Size The count of elements of the state.
+template <typename Type, std::size_t Size> struct unscented_transform {
+  //! @name Public Member Variables
+  //! @{
+
+  //! @brief The count of sigma points.
+  inline constexpr static std::size_t points{2 * Size + 1};
+
+  //! @brief The spread of the sigma points.
+  Type alpha{1};
+
+  //! @brief The prior knowledge of the distribution, two for a Gaussian.
+  Type beta{2};
+
+  //! @brief The secondary scaling parameter.
+  Type kappa{0};
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief The scaling parameter `lambda`.
+  [[nodiscard]] inline constexpr Type lambda() const {
+    return alpha * alpha * (Type(Size) + kappa) - Type(Size);
+  }
+
+  //! @brief The weight of the sigma point in the mean.
+  [[nodiscard]] inline constexpr Type mean_weight(std::size_t point) const {
+    if (point == 0) {
+      return lambda() / (Type(Size) + lambda());
+    }
+
+    return Type{1} / (Type{2} * (Type(Size) + lambda()));
+  }
+
+  //! @brief The weight of the sigma point in the covariance.
+  [[nodiscard]] inline constexpr Type
+  covariance_weight(std::size_t point) const {
+    if (point == 0) {
+      return mean_weight(0) + Type{1} - alpha * alpha + beta;
+    }
+
+    return mean_weight(point);
+  }
+
+  //! @}
+};
+
+//! @brief Fixed-capacity ring buffer of typed column vectors.
+//!
+//! @details The sliding window of the most recent samples of a stream of typed
+//! column vectors. The samples are stored contiguously. The window mean and
+//! covariance are updated incrementally in `O(n^2)` operations per sample,
+//! evicting the oldest sample once full, by the evaluation kernels of the
+//! typed operations. No allocation occurs after construction.
+//!
+//! @tparam Vector The typed column vector of the samples.
+//! @tparam Capacity The count of samples of the full window.
+template <typename Vector, std::size_t Capacity> class typed_ring_buffer {
+  static_assert(tla::typed_matrix<Vector> && tla::column<Vector>);
+  static_assert(Capacity > 0);
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the samples.
+  using value_type = Vector;
+
+  //! @brief The typed covariance of the samples, indexed by the rows of the
+  //! samples.
+  using covariance_type = typed_matrix<
+      tla::evaluate<tla::product<decltype(Vector::data),
+                                 tla::transpose<decltype(Vector::data)>>>,
+      typename Vector::row_indexes, typename Vector::row_indexes>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Appends the sample, evicting the oldest sample of a full window.
+  inline constexpr void push(const Vector &sample) {
+    constexpr std::uint64_t size{Vector::rows};
+
+    tla::record<storage>(4 * size * size + 6 * size, 2 * size * size);
+
+    if (count < Capacity) {
+      ++count;
+      samples[(head + count - 1) % Capacity] = sample;
+
+      const storage delta{tla::subtract<storage>(sample.data, average)};
+
+      average = tla::add<storage>(
+          average, tla::divide<storage>(delta, underlying(count)));
+
+      const storage residual{tla::subtract<storage>(sample.data, average)};
+
+      scatter = tla::add<scatter_storage>(
+          scatter, tla::multiply<scatter_storage>(
+                       delta, tla::transposes<storage>{}(residual)));
+
+      return;
+    }
+
+    const storage previous{average};
+    const storage oldest{samples[head].data};
+
+    samples[head] = sample;
+    head = (head + 1) % Capacity;
+    average = tla::add<storage>(
+        average,
+        tla::divide<storage>(tla::subtract<storage>(sample.data, oldest),
+                             underlying(Capacity)));
+
+    const storage entering{tla::subtract<storage>(sample.data, previous)};
+    const storage entered{tla::subtract<storage>(sample.data, average)};
+    const storage leaving{tla::subtract<storage>(oldest, previous)};
+    const storage left{tla::subtract<storage>(oldest, average)};
+
+    scatter = tla::add<scatter_storage>(
+        scatter,
+        tla::subtract<scatter_storage>(
+            tla::multiply<scatter_storage>(
+                entering, tla::transposes<storage>{}(entered)),
+            tla::multiply<scatter_storage>(
+                leaving, tla::transposes<storage>{}(left))));
+  }
+
+  //! @brief Empties the window.
+  inline constexpr void clear() {
+    head = 0;
+    count = 0;
+    average = zero_storage();
+    scatter = zero_scatter();
+  }
+
+  //! @brief The sample at the position, the oldest sample first.
+  [[nodiscard]] inline constexpr const Vector &
+  operator[](std::size_t index) const {
+    return samples[(head + index) % Capacity];
+  }
+
+  //! @brief The oldest sample.
+  [[nodiscard]] inline constexpr const Vector &front() const {
+    return samples[head];
+  }
+
+  //! @brief The most recent sample.
+  [[nodiscard]] inline constexpr const Vector &back() const {
+    return samples[(head + count - 1) % Capacity];
+  }
+
+  //! @brief The count of samples in the window.
+  [[nodiscard]] inline constexpr std::size_t size() const { return count; }
+
+  //! @brief The count of samples of the full window.
+  [[nodiscard]] inline constexpr std::size_t capacity() const {
+    return Capacity;
+  }
+
+  //! @brief Whether the window has no sample.
+  [[nodiscard]] inline constexpr bool empty() const { return count == 0; }
+
+  //! @brief Whether the window is full.
+  [[nodiscard]] inline constexpr bool full() const {
+    return count == Capacity;
+  }
+
+  //! @brief The mean of the samples of the window.
+  [[nodiscard]] inline constexpr Vector mean() const {
+    const Vector result{average};
+
+    tla::inspect("window mean", result);
+
+    return result;
+  }
+
+  //! @brief The unbiased sample covariance of the samples of the window.
+  //!
+  //! @details Zero for less than two samples.
+  [[nodiscard]] inline constexpr covariance_type covariance() const {
+    if (count < 2) {
+      return covariance_type{zero_scatter()};
+    }
+
+    const covariance_type result{
+        tla::divide<scatter_storage>(scatter, underlying(count - 1))};
+
+    tla::inspect("window covariance", result);
+
+    return result;
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The type of the element's underlying storage.
+  using underlying = tla::underlying_t<decltype(Vector::data)>;
+
+  //! @brief The underlying storage of a sample.
+  using storage = tla::evaluate<decltype(Vector::data)>;
+
+  //! @brief The underlying storage of the scatter matrix.
+  using scatter_storage =
+      tla::evaluate<tla::product<storage, tla::transpose<storage>>>;
+
+  //! @}
+
+  //! @name Private Member Functions
+  //! @{
+
+  [[nodiscard]] static inline constexpr storage zero_storage() {
+    storage result;
+
+    for (std::size_t i{0}; i < Vector::rows; ++i) {
+      result(i, 0) = underlying{0};
+    }
+
+    return result;
+  }
+
+  [[nodiscard]] static inline constexpr scatter_storage zero_scatter() {
+    scatter_storage result;
+
+    for (std::size_t i{0}; i < Vector::rows; ++i) {
+      for (std::size_t j{0}; j < Vector::rows; ++j) {
+        result(i, j) = underlying{0};
+      }
+    }
+
+    return result;
+  }
+
+  //! @}
+
+  //! @name Private Member Variables
+  //! @{
+
+  std::array<Vector, Capacity> samples{};
+  std::size_t head{0};
+  std::size_t count{0};
+  storage average{zero_storage()};
+  scatter_storage scatter{zero_scatter()};
+
+  //! @}
+};
+
+//! @brief Copy-on-write shared snapshot of a typed matrix.
+//!
+//! @details An immutable typed matrix published from a writer to many readers.
+//! The writer publishes a new typed matrix into a new allocation, the readers
+//! acquire the reference-counted storage of the freshest publication. An
+//! acquired storage is never modified: the readers keep it, free of data
+//! races, as long as they need it, and read it through constant typed views
+//! usable in all the typed operations. The publications and the acquisitions
+//! are atomic, with release and acquire ordering. The copies of a snapshot
+//! share the storage of its last publication. One writer thread at most
+//! publishes at a time. The storage and its reference count are allocated
+//! together by the allocator, such as the huge page or the node-local
+//! allocators of the large typed matrices.
+//!
+//! @tparam TypedMatrix The typed matrix of the snapshot.
+//! @tparam Allocator The allocator of the storage.
+template <typename TypedMatrix,
+          typename Allocator = std::allocator<TypedMatrix>>
+class typed_snapshot {
+  static_assert(tla::typed_matrix<TypedMatrix>);
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The typed matrix of the snapshot.
+  using value_type = TypedMatrix;
+
+  //! @brief The allocator of the storage.
+  using allocator_type = Allocator;
+
+  //! @brief The shared constant storage of a publication.
+  using pointer = std::shared_ptr<const TypedMatrix>;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Allocates the snapshot of a default typed matrix.
+  inline typed_snapshot() : typed_snapshot{TypedMatrix{}} {}
+
+  //! @brief Allocates the snapshot of the typed matrix.
+  inline explicit typed_snapshot(const TypedMatrix &value,
+                                 const Allocator &allocator = Allocator{})
+      : storage{std::allocate_shared<TypedMatrix>(allocator, value)},
+        storage_allocator{allocator} {}
+
+  //! @brief Allocates the snapshot of the typed matrix.
+  inline explicit typed_snapshot(TypedMatrix &&value,
+                                 const Allocator &allocator = Allocator{})
+      : storage{std::allocate_shared<TypedMatrix>(allocator, std::move(value))},
+        storage_allocator{allocator} {}
+
+  //! @brief Shares the storage of the last publication of the other snapshot.
+  inline typed_snapshot(const typed_snapshot &other)
+      : storage{other.acquire()}, storage_allocator{other.storage_allocator} {}
+
+  //! @brief Publishes the storage of the last publication of the other
+  //! snapshot.
+  inline typed_snapshot &operator=(const typed_snapshot &other) {
+    storage_allocator = other.storage_allocator;
+    storage.store(other.acquire(), std::memory_order_release);
+
+    return *this;
+  }
+
+  //! @brief The constant storage of the last publication.
+  //!
+  //! @details The storage stays valid and unchanged while the reader holds it,
+  //! whatever the later publications.
+  [[nodiscard]] inline pointer acquire() const noexcept {
+    return storage.load(std::memory_order_acquire);
+  }
+
+  //! @brief Publishes the typed matrix in a new allocation.
+  inline void publish(const TypedMatrix &value) {
+    storage.store(std::allocate_shared<TypedMatrix>(storage_allocator, value),
+                  std::memory_order_release);
+  }
+
+  //! @brief Publishes the typed matrix in a new allocation.
+  inline void publish(TypedMatrix &&value) {
+    storage.store(
+        std::allocate_shared<TypedMatrix>(storage_allocator, std::move(value)),
+        std::memory_order_release);
+  }
+
+  //! @brief Publishes a modified copy of the last publication.
+  //!
+  //! @details The writer modifies a copy in a new allocation, invisible to the
+  //! readers until its publication. The mutable typed matrix is only
+  //! reachable from the modification.
+  //!
+  //! @param modify The modification of the mutable typed matrix.
+  template <typename Function> inline void update(Function &&modify) {
+    std::shared_ptr<TypedMatrix> copy{
+        std::allocate_shared<TypedMatrix>(storage_allocator, *acquire())};
+
+    std::forward<Function>(modify)(*copy);
+    storage.store(std::move(copy), std::memory_order_release);
+  }
+
+  //! @brief The allocator of the storage.
+  [[nodiscard]] inline allocator_type get_allocator() const noexcept {
+    return storage_allocator;
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The reference-counted storage of the last publication.
+  std::atomic<pointer> storage;
+
+  //! @brief The allocator of the publications.
+  Allocator storage_allocator;
+
+  //! @}
+};
+
+//! @brief Lock-free single-writer many-reader channel of a typed matrix.
+//!
+//! @details A sequence lock hands off the freshest typed matrix of a writer to
+//! the readers without blocking the writer. The stores are wait-free: the
+//! writer never waits for the readers. A load retries while it overlaps a
+//! store. The elements are copied through relaxed atomics, free of data
+//! races. The sequence and the elements are isolated on their own cache lines.
+//! One writer thread at most stores at a time.
+//!
+//! @tparam TypedMatrix The fixed-size typed matrix of the channel.
+template <typename TypedMatrix> class typed_channel {
+  static_assert(tla::typed_matrix<TypedMatrix>);
+
+private:
+  //! @name Private Member Types
+  //! @{
+
+  //! @brief The type of the element's underlying storage.
+  using underlying = typename TypedMatrix::underlying;
+
+  //! @}
+
+  static_assert(std::is_trivially_copyable_v<underlying>);
+  static_assert(std::atomic<underlying>::is_always_lock_free);
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The typed matrix of the channel.
+  using value_type = TypedMatrix;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the channel of zero elements.
+  inline typed_channel() = default;
+
+  //! @brief Constructs the channel of the typed matrix.
+  inline explicit typed_channel(const TypedMatrix &value) { store(value); }
+
+  typed_channel(const typed_channel &other) = delete;
+  typed_channel &operator=(const typed_channel &other) = delete;
+
+  //! @brief Publishes the typed matrix, wait-free.
+  //!
+  //! @details The sequence is odd during the store, the overlapping loads
+  //! retry.
+  inline void store(const TypedMatrix &value) noexcept {
+    const std::uint64_t current{sequence.load(std::memory_order_relaxed)};
+
+    sequence.store(current + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    for (std::size_t j{0}; j < TypedMatrix::columns; ++j) {
+      for (std::size_t i{0}; i < TypedMatrix::rows; ++i) {
+        elements[j * TypedMatrix::rows + i].store(value.data(i, j),
+                                                  std::memory_order_relaxed);
+      }
+    }
+
+    sequence.store(current + 2, std::memory_order_release);
+  }
+
+  //! @brief The freshest published typed matrix.
+  //!
+  //! @details Retries the copy of the elements until no store overlapped it.
+  [[nodiscard]] inline TypedMatrix load() const noexcept {
+    TypedMatrix result;
+
+    for (;;) {
+      const std::uint64_t before{sequence.load(std::memory_order_acquire)};
+
+      if (before % 2 == 0) {
+        for (std::size_t j{0}; j < TypedMatrix::columns; ++j) {
+          for (std::size_t i{0}; i < TypedMatrix::rows; ++i) {
+            result.data(i, j) = elements[j * TypedMatrix::rows + i].load(
+                std::memory_order_relaxed);
+          }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        if (sequence.load(std::memory_order_relaxed) == before) {
+          return result;
+        }
+      }
+    }
+  }
+
+  //! @brief The count of completed publications.
+  [[nodiscard]] inline std::uint64_t version() const noexcept {
+    return sequence.load(std::memory_order_acquire) / 2;
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The size of the cache line isolating the members.
+  inline constexpr static std::size_t cache_line{64};
+
+  //! @brief The count of elements.
+  inline constexpr static std::size_t size{TypedMatrix::rows *
+                                           TypedMatrix::columns};
+
+  //! @brief The sequence of the stores, odd during a store.
+  alignas(cache_line) std::atomic<std::uint64_t> sequence{0};
+
+  //! @brief The elements, in column-major order.
+  alignas(cache_line) std::array<std::atomic<underlying>, size> elements{};
+
+  //! @}
+};
+
+//! @}
+
+//! @name Functions
+//! @{
+
+//! @brief The compile-time identity of the square typed matrix.
+template <tla::typed_matrix TypedMatrix>
+  requires tla::same_size<typename TypedMatrix::row_indexes,
+                          typename TypedMatrix::column_indexes>
+[[nodiscard]] inline constexpr identity_matrix<TypedMatrix> identity() {
+  return {};
+}
+
+//! @brief The compile-time zero of the typed matrix.
+template <tla::typed_matrix TypedMatrix>
+[[nodiscard]] inline constexpr zero_matrix<TypedMatrix> zero() {
+  return {};
+}
+
 //! @}
 
 } // namespace fcarouge
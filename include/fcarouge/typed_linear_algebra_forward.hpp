@@ -38,9 +38,46 @@ For more information, please refer to <https://unlicense.org> */
 //! @details Use this authoritative header to forward declare the types of this
 //! project and avoid inconsistent declarations.
 
+#include <cstddef>
+
 namespace fcarouge {
 template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
 struct typed_matrix;
+
+template <typename TypedMatrix> struct identity_matrix;
+
+template <typename TypedMatrix> struct zero_matrix;
+
+enum class stacking;
+
+template <stacking Direction, typename... Pieces> struct typed_stack;
+
+template <typename Lhs, typename Rhs> struct typed_kronecker;
+
+template <typename Vector, typename RowIndexes, typename ColumnIndexes>
+struct typed_diagonal_matrix;
+
+enum class triangle;
+
+enum class storage_order;
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes,
+          triangle Part>
+struct typed_triangular_factor;
+
+template <typename... Blocks> struct typed_block_diagonal_matrix;
+
+template <typename Drift, typename Input, typename Density,
+          std::size_t Capacity>
+class discretization_cache;
+
+template <typename Type, std::size_t Size> struct unscented_transform;
+
+template <typename Vector, std::size_t Capacity> class typed_ring_buffer;
+
+template <typename TypedMatrix, typename Allocator> class typed_snapshot;
+
+template <typename TypedMatrix> class typed_channel;
 } // namespace fcarouge
 
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_FORWARD_HPP
@@ -0,0 +1,288 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALLOCATOR_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace fcarouge::typed_linear_algebra_internal {
+
+//! @name Constants
+//! @{
+
+//! @brief The size in bytes of the smallest page of the memory.
+inline constexpr std::size_t page_size{4096};
+
+//! @brief The size in bytes of a transparent huge page of the memory.
+inline constexpr std::size_t huge_page_size{2 * 1024 * 1024};
+
+//! @}
+
+//! @name Functions
+//! @{
+
+//! @brief The size rounded up to the multiple of the alignment.
+[[nodiscard]] inline constexpr std::size_t round_up(std::size_t size,
+                                                    std::size_t alignment) {
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+//! @brief Maps fresh memory aligned on and backed by huge pages.
+//!
+//! @details The memory is never recycled from another allocation: no page is
+//! resident until first touched. On Linux, the anonymous mapping is aligned on
+//! a huge page and advised for transparent huge pages. Elsewhere, the aligned
+//! allocation operator is the fallback.
+//!
+//! @param size The size in bytes, a multiple of the huge page size.
+[[nodiscard]] inline void *map_huge_pages(std::size_t size) {
+#if defined(__linux__)
+  void *mapping{::mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+
+  if (mapping == MAP_FAILED) {
+    throw std::bad_alloc{};
+  }
+
+  //! The unaligned head and the tail of the over-sized mapping are unmapped.
+  const auto address{reinterpret_cast<std::uintptr_t>(mapping)};
+  const std::uintptr_t aligned{round_up(address, huge_page_size)};
+  const std::size_t head{aligned - address};
+
+  if (head > 0) {
+    ::munmap(mapping, head);
+  }
+
+  if (huge_page_size - head > 0) {
+    ::munmap(reinterpret_cast<void *>(aligned + size), huge_page_size - head);
+  }
+
+  //! The advice is a hint: the memory is usable without huge pages.
+  ::madvise(reinterpret_cast<void *>(aligned), size, MADV_HUGEPAGE);
+
+  return reinterpret_cast<void *>(aligned);
+#else
+  return ::operator new(size, std::align_val_t{huge_page_size});
+#endif
+}
+
+//! @brief Unmaps the memory of the huge pages.
+inline void unmap_huge_pages(void *pointer, std::size_t size) noexcept {
+#if defined(__linux__)
+  ::munmap(pointer, size);
+#else
+  ::operator delete(pointer, size, std::align_val_t{huge_page_size});
+#endif
+}
+
+//! @}
+
+} // namespace fcarouge::typed_linear_algebra_internal
+
+namespace fcarouge {
+
+//! @name Types
+//! @{
+
+//! @brief Transparent huge page allocator.
+//!
+//! @details Allocates fresh memory aligned on the huge pages, advised to be
+//! backed by transparent huge pages on Linux. One translation lookaside buffer
+//! entry maps each huge page instead of five hundred and twelve small pages:
+//! the large typed batches traversed by the products and the updates miss the
+//! buffer less. The sizes are rounded up to the huge page, intended for the
+//! large allocations.
+//!
+//! @tparam Type The type of the allocated elements.
+template <typename Type> class huge_page_allocator {
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the allocated elements.
+  using value_type = Type;
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the stateless allocator.
+  inline constexpr huge_page_allocator() noexcept = default;
+
+  //! @brief Constructs the stateless allocator of another element type.
+  template <typename Other>
+  inline constexpr explicit(false)
+      huge_page_allocator(const huge_page_allocator<Other> &other) noexcept {
+    static_cast<void>(other);
+  }
+
+  //! @brief Allocates the storage of the count of elements.
+  [[nodiscard]] inline Type *allocate(std::size_t count) {
+    static_assert(alignof(Type) <= typed_linear_algebra_internal::page_size);
+
+    return static_cast<Type *>(
+        typed_linear_algebra_internal::map_huge_pages(size(count)));
+  }
+
+  //! @brief Deallocates the storage of the count of elements.
+  inline void deallocate(Type *pointer, std::size_t count) noexcept {
+    typed_linear_algebra_internal::unmap_huge_pages(pointer, size(count));
+  }
+
+  //! @brief The stateless allocators are all equal.
+  template <typename Other>
+  [[nodiscard]] inline constexpr bool
+  operator==(const huge_page_allocator<Other> &other) const noexcept {
+    static_cast<void>(other);
+    return true;
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Functions
+  //! @{
+
+  //! @brief The size in bytes of the mapping of the count of elements.
+  [[nodiscard]] static inline constexpr std::size_t size(std::size_t count) {
+    return typed_linear_algebra_internal::round_up(
+        count * sizeof(Type), typed_linear_algebra_internal::huge_page_size);
+  }
+
+  //! @}
+};
+
+//! @brief NUMA node-local first-touch allocator.
+//!
+//! @details The operating system places a page on the node of the thread first
+//! touching it. The allocator touches every page of a fresh allocation from
+//! the allocating thread: the storage is resident on the node of that thread,
+//! whichever thread later constructs or writes the elements. Allocate the
+//! batch of each worker from the worker thread pinned to its node for the
+//! traversals to stay free of cross-socket traffic. The upstream allocator must
+//! return fresh memory for the placement to take effect, memory recycled from
+//! another allocation stays on its node.
+//!
+//! @tparam Type The type of the allocated elements.
+//! @tparam Upstream The allocator of the fresh memory, huge pages by default.
+template <typename Type, typename Upstream = huge_page_allocator<Type>>
+class node_local_allocator {
+  static_assert(std::is_same_v<typename Upstream::value_type, Type>);
+
+public:
+  //! @name Public Member Types
+  //! @{
+
+  //! @brief The type of the allocated elements.
+  using value_type = Type;
+
+  //! @brief The allocator of another element type, of the same upstream.
+  template <typename Other> struct rebind {
+    using other = node_local_allocator<
+        Other,
+        typename std::allocator_traits<Upstream>::template rebind_alloc<Other>>;
+  };
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  //! @brief Constructs the allocator of a default upstream.
+  inline constexpr node_local_allocator() = default;
+
+  //! @brief Constructs the allocator of the upstream.
+  inline constexpr explicit node_local_allocator(const Upstream &other)
+      : allocator{other} {}
+
+  //! @brief Constructs the allocator of another element type.
+  template <typename Other, typename OtherUpstream>
+  inline constexpr explicit(false) node_local_allocator(
+      const node_local_allocator<Other, OtherUpstream> &other)
+      : allocator{other.upstream()} {}
+
+  //! @brief Allocates and first touches the storage of the count of elements.
+  [[nodiscard]] inline Type *allocate(std::size_t count) {
+    Type *pointer{allocator.allocate(count)};
+    volatile auto *bytes{reinterpret_cast<volatile unsigned char *>(pointer)};
+
+    for (std::size_t i{0}; i < count * sizeof(Type);
+         i += typed_linear_algebra_internal::page_size) {
+      bytes[i] = 0;
+    }
+
+    return pointer;
+  }
+
+  //! @brief Deallocates the storage of the count of elements.
+  inline void deallocate(Type *pointer, std::size_t count) noexcept {
+    allocator.deallocate(pointer, count);
+  }
+
+  //! @brief The upstream allocator.
+  [[nodiscard]] inline constexpr const Upstream &upstream() const noexcept {
+    return allocator;
+  }
+
+  //! @brief The allocators of equal upstreams are equal.
+  template <typename Other, typename OtherUpstream>
+  [[nodiscard]] inline constexpr bool
+  operator==(const node_local_allocator<Other, OtherUpstream> &other) const {
+    return allocator == other.upstream();
+  }
+
+  //! @}
+
+private:
+  //! @name Private Member Variables
+  //! @{
+
+  //! @brief The allocator of the fresh memory.
+  Upstream allocator;
+
+  //! @}
+};
+
+//! @}
+
+} // namespace fcarouge
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_ALLOCATOR_HPP
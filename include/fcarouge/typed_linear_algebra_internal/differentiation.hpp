@@ -0,0 +1,244 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_DIFFERENTIATION_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_DIFFERENTIATION_HPP
+
+//! @file
+//! @brief Forward-mode automatic differentiation.
+//!
+//! @details The dual number is an underlying element type of the typed
+//! matrices. Evaluating a typed model on dual numbers computes its value and
+//! its partial derivatives together.
+
+#include "utility.hpp"
+
+#include <array>
+#include <cmath>
+#include <compare>
+#include <cstddef>
+
+namespace fcarouge {
+
+//! @name Types
+//! @{
+
+//! @brief Forward-mode automatic differentiation dual number.
+//!
+//! @details The value of an expression and its partial derivatives with
+//! respect to the `Size` variables. The lanes of the gradient are contiguous,
+//! each operation updates all of them together in a vectorizable loop.
+//! Constants convert implicitly to dual numbers of null gradients.
+//!
+//! @tparam Type The type of the value and of the partial derivatives.
+//! @tparam Size The count of variables.
+template <typename Type, std::size_t Size> struct dual {
+  //! @name Public Member Variables
+  //! @{
+
+  //! @brief The value of the expression.
+  Type value{};
+
+  //! @brief The partial derivatives of the expression per variable.
+  std::array<Type, Size> gradient{};
+
+  //! @}
+
+  //! @name Public Member Functions
+  //! @{
+
+  inline constexpr dual() = default;
+
+  //! @brief A constant.
+  inline constexpr dual(Type constant) : value{constant} {}
+
+  //! @brief The variable of the index, its own derivative is one.
+  inline constexpr dual(Type variable, std::size_t index) : value{variable} {
+    gradient[index] = Type{1};
+  }
+
+  inline constexpr dual &operator+=(const dual &other) {
+    value += other.value;
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      gradient[i] += other.gradient[i];
+    }
+
+    return *this;
+  }
+
+  inline constexpr dual &operator-=(const dual &other) {
+    value -= other.value;
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      gradient[i] -= other.gradient[i];
+    }
+
+    return *this;
+  }
+
+  inline constexpr dual &operator*=(const dual &other) {
+    for (std::size_t i{0}; i < Size; ++i) {
+      gradient[i] = gradient[i] * other.value + value * other.gradient[i];
+    }
+
+    value *= other.value;
+
+    return *this;
+  }
+
+  inline constexpr dual &operator/=(const dual &other) {
+    const Type inverse{Type{1} / other.value};
+
+    value *= inverse;
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      gradient[i] = (gradient[i] - value * other.gradient[i]) * inverse;
+    }
+
+    return *this;
+  }
+
+  //! @}
+
+  //! @name Friend Functions
+  //! @{
+
+  [[nodiscard]] friend inline constexpr dual operator-(dual operand) {
+    operand.value = -operand.value;
+
+    for (auto &derivative : operand.gradient) {
+      derivative = -derivative;
+    }
+
+    return operand;
+  }
+
+  [[nodiscard]] friend inline constexpr dual operator+(dual lhs,
+                                                       const dual &rhs) {
+    return lhs += rhs;
+  }
+
+  [[nodiscard]] friend inline constexpr dual operator-(dual lhs,
+                                                       const dual &rhs) {
+    return lhs -= rhs;
+  }
+
+  [[nodiscard]] friend inline constexpr dual operator*(dual lhs,
+                                                       const dual &rhs) {
+    return lhs *= rhs;
+  }
+
+  [[nodiscard]] friend inline constexpr dual operator/(dual lhs,
+                                                       const dual &rhs) {
+    return lhs /= rhs;
+  }
+
+  //! @brief Compares the values, regardless of the derivatives.
+  [[nodiscard]] friend inline constexpr bool operator==(const dual &lhs,
+                                                        const dual &rhs) {
+    return lhs.value == rhs.value;
+  }
+
+  //! @brief Orders the values, regardless of the derivatives.
+  [[nodiscard]] friend inline constexpr auto operator<=>(const dual &lhs,
+                                                         const dual &rhs) {
+    return lhs.value <=> rhs.value;
+  }
+
+  [[nodiscard]] friend inline dual sqrt(const dual &operand) {
+    const Type root{std::sqrt(operand.value)};
+
+    return chain(operand, root, Type{1} / (Type{2} * root));
+  }
+
+  [[nodiscard]] friend inline dual exp(const dual &operand) {
+    const Type exponential{std::exp(operand.value)};
+
+    return chain(operand, exponential, exponential);
+  }
+
+  [[nodiscard]] friend inline dual log(const dual &operand) {
+    return chain(operand, std::log(operand.value), Type{1} / operand.value);
+  }
+
+  [[nodiscard]] friend inline dual sin(const dual &operand) {
+    return chain(operand, std::sin(operand.value), std::cos(operand.value));
+  }
+
+  [[nodiscard]] friend inline dual cos(const dual &operand) {
+    return chain(operand, std::cos(operand.value), -std::sin(operand.value));
+  }
+
+  //! @}
+
+private:
+  //! @brief The function of the operand of the value and of the derivative.
+  [[nodiscard]] static inline constexpr dual
+  chain(const dual &operand, Type value, Type derivative) {
+    dual result{value};
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      result.gradient[i] = derivative * operand.gradient[i];
+    }
+
+    return result;
+  }
+};
+
+//! @}
+
+//! @brief Element traits of the dual numbers.
+//!
+//! @details The elements of a typed matrix evaluated on dual numbers remain
+//! dual numbers to carry their derivatives through the typed operations.
+template <typename Type, std::size_t Size, typename Element>
+struct typed_linear_algebra_internal::element_traits<dual<Type, Size>,
+                                                     Element> {
+  [[nodiscard]] static inline constexpr dual<Type, Size>
+  to_underlying(const Element &value) {
+    return value;
+  }
+
+  [[nodiscard]] static inline constexpr dual<Type, Size> &
+  from_underlying(dual<Type, Size> &value) {
+    return value;
+  }
+
+  [[nodiscard]] static inline constexpr const dual<Type, Size> &
+  from_underlying(const dual<Type, Size> &value) {
+    return value;
+  }
+};
+
+} // namespace fcarouge
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_DIFFERENTIATION_HPP
@@ -0,0 +1,208 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_EXPONENTIAL_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_EXPONENTIAL_HPP
+
+//! @file
+//! @brief Matrix exponential kernels.
+//!
+//! @details Backend agnostic kernels operating on element accessors of
+//! compile-time sized square matrices. Work matrices are fixed-size row-major
+//! arrays, no allocation occurs.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace fcarouge::typed_linear_algebra_internal {
+
+//! @name Functions
+//! @{
+
+//! @brief In-place matrix exponential by scaling and squaring.
+//!
+//! @details The matrix is scaled by a power of two to an infinity norm of at
+//! most one half. The diagonal Pade approximant of degree six of the scaled
+//! matrix is solved by Gaussian elimination with partial pivoting, then
+//! squared back as many times as the matrix was halved. The approximation is
+//! accurate to the double precision for the scaled norm. The exponential of a
+//! matrix of infinite norm is not a number, without scaling.
+//!
+//! @return The count of squarings.
+template <typename Type, std::size_t Size, typename Matrix>
+inline constexpr std::size_t exponential(Matrix &&matrix) {
+  using square = std::array<Type, Size * Size>;
+  constexpr std::size_t degree{6};
+
+  const auto multiply{[](const square &lhs, const square &rhs) {
+    square result{};
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      for (std::size_t k{0}; k < Size; ++k) {
+        for (std::size_t j{0}; j < Size; ++j) {
+          result[i * Size + j] += lhs[i * Size + k] * rhs[k * Size + j];
+        }
+      }
+    }
+
+    return result;
+  }};
+
+  square scaled{};
+  Type norm{0};
+
+  for (std::size_t i{0}; i < Size; ++i) {
+    Type sum{0};
+
+    for (std::size_t j{0}; j < Size; ++j) {
+      const Type value{matrix(i, j)};
+
+      scaled[i * Size + j] = value;
+      sum += value < Type{0} ? -value : value;
+    }
+
+    norm = sum > norm ? sum : norm;
+  }
+
+  if (!std::isfinite(norm)) {
+    for (std::size_t i{0}; i < Size; ++i) {
+      for (std::size_t j{0}; j < Size; ++j) {
+        matrix(i, j) = std::numeric_limits<Type>::quiet_NaN();
+      }
+    }
+
+    return 0;
+  }
+
+  std::size_t squarings{0};
+  Type scale{1};
+
+  for (; norm > Type{0.5}; ++squarings) {
+    norm /= Type{2};
+    scale /= Type{2};
+  }
+
+  for (auto &value : scaled) {
+    value *= scale;
+  }
+
+  square numerator{};
+  square denominator{};
+  square power{scaled};
+  Type coefficient{0.5};
+
+  for (std::size_t i{0}; i < Size * Size; ++i) {
+    numerator[i] = coefficient * scaled[i];
+    denominator[i] = -coefficient * scaled[i];
+  }
+
+  for (std::size_t i{0}; i < Size; ++i) {
+    numerator[i * Size + i] += Type{1};
+    denominator[i * Size + i] += Type{1};
+  }
+
+  for (std::size_t k{2}; k <= degree; ++k) {
+    coefficient *= Type(degree - k + 1) / Type(k * (2 * degree - k + 1));
+    power = multiply(scaled, power);
+
+    for (std::size_t i{0}; i < Size * Size; ++i) {
+      numerator[i] += coefficient * power[i];
+      denominator[i] += (k % 2 ? -coefficient : coefficient) * power[i];
+    }
+  }
+
+  //! Solves `D * X = N` in place of the numerator `N`.
+  for (std::size_t j{0}; j < Size; ++j) {
+    std::size_t pivot{j};
+
+    for (std::size_t i{j + 1}; i < Size; ++i) {
+      const Type candidate{denominator[i * Size + j]};
+      const Type current{denominator[pivot * Size + j]};
+
+      if ((candidate < Type{0} ? -candidate : candidate) >
+          (current < Type{0} ? -current : current)) {
+        pivot = i;
+      }
+    }
+
+    if (pivot != j) {
+      for (std::size_t k{0}; k < Size; ++k) {
+        std::swap(denominator[j * Size + k], denominator[pivot * Size + k]);
+        std::swap(numerator[j * Size + k], numerator[pivot * Size + k]);
+      }
+    }
+
+    for (std::size_t i{j + 1}; i < Size; ++i) {
+      const Type factor{denominator[i * Size + j] / denominator[j * Size + j]};
+
+      for (std::size_t k{j}; k < Size; ++k) {
+        denominator[i * Size + k] -= factor * denominator[j * Size + k];
+      }
+
+      for (std::size_t k{0}; k < Size; ++k) {
+        numerator[i * Size + k] -= factor * numerator[j * Size + k];
+      }
+    }
+  }
+
+  for (std::size_t i{Size}; i-- > 0;) {
+    for (std::size_t k{0}; k < Size; ++k) {
+      Type value{numerator[i * Size + k]};
+
+      for (std::size_t j{i + 1}; j < Size; ++j) {
+        value -= denominator[i * Size + j] * numerator[j * Size + k];
+      }
+
+      numerator[i * Size + k] = value / denominator[i * Size + i];
+    }
+  }
+
+  for (std::size_t s{0}; s < squarings; ++s) {
+    numerator = multiply(numerator, numerator);
+  }
+
+  for (std::size_t i{0}; i < Size; ++i) {
+    for (std::size_t j{0}; j < Size; ++j) {
+      matrix(i, j) = numerator[i * Size + j];
+    }
+  }
+
+  return squarings;
+}
+
+//! @}
+
+} // namespace fcarouge::typed_linear_algebra_internal
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_EXPONENTIAL_HPP
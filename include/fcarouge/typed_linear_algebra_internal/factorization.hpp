@@ -0,0 +1,257 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_FACTORIZATION_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_FACTORIZATION_HPP
+
+//! @file
+//! @brief Triangular factorization kernels.
+//!
+//! @details Backend agnostic kernels operating on element accessors of
+//! compile-time sized matrices. The accessors return a reference to the element
+//! at the given row and column position. Work vectors are fixed-size arrays, no
+//! allocation occurs.
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+
+namespace fcarouge::typed_linear_algebra_internal {
+
+//! @name Functions
+//! @{
+
+//! @brief In-place Cholesky factorization to a lower triangle.
+//!
+//! @details The symmetric positive definite matrix is read from its lower
+//! triangle and overwritten by its lower triangular factor `L` such that the
+//! matrix is `L * L^T`. The strict upper triangle is zeroed.
+//!
+//! @return False if the matrix is not positive definite.
+template <typename Type, std::size_t Size, typename Lower>
+[[nodiscard]] inline constexpr bool cholesky(Lower &&lower) {
+  for (std::size_t j{0}; j < Size; ++j) {
+    Type diagonal{lower(j, j)};
+
+    for (std::size_t k{0}; k < j; ++k) {
+      diagonal -= lower(j, k) * lower(j, k);
+    }
+
+    if (diagonal <= Type{0}) {
+      return false;
+    }
+
+    lower(j, j) = std::sqrt(diagonal);
+
+    for (std::size_t i{j + 1}; i < Size; ++i) {
+      Type value{lower(i, j)};
+
+      for (std::size_t k{0}; k < j; ++k) {
+        value -= lower(i, k) * lower(j, k);
+      }
+
+      lower(i, j) = value / lower(j, j);
+      lower(j, i) = Type{0};
+    }
+  }
+
+  return true;
+}
+
+//! @brief In-place rank-one update or downdate of a lower triangular factor.
+//!
+//! @details Updates the factor `L` to the factor of `L * L^T + sigma * v *
+//! v^T` in `O(n^2)` operations. A negative sigma downdates the factor.
+//!
+//! @return False if the downdated matrix is not positive definite, the factor
+//! is then left in an unspecified state.
+template <typename Type, std::size_t Size, typename Lower>
+[[nodiscard]] inline constexpr bool
+rank_update(Lower &&lower, std::array<Type, Size> vector, Type sigma) {
+  Type beta{1};
+
+  for (std::size_t j{0}; j < Size; ++j) {
+    const Type ljj{lower(j, j)};
+    const Type djj{ljj * ljj};
+    const Type wj{vector[j]};
+    const Type swj2{sigma * wj * wj};
+    const Type gamma{djj * beta + swj2};
+    const Type x{djj + swj2 / beta};
+
+    if (x <= Type{0}) {
+      return false;
+    }
+
+    const Type nljj{std::sqrt(x)};
+
+    lower(j, j) = nljj;
+    beta += swj2 / djj;
+
+    for (std::size_t i{j + 1}; i < Size; ++i) {
+      vector[i] -= wj / ljj * lower(i, j);
+    }
+
+    if (gamma != Type{0}) {
+      for (std::size_t i{j + 1}; i < Size; ++i) {
+        lower(i, j) =
+            nljj / ljj * lower(i, j) + nljj * sigma * wj / gamma * vector[i];
+      }
+    }
+  }
+
+  return true;
+}
+
+//! @brief In-place forward substitution solving `L * X = B`.
+template <typename Type, std::size_t Size, std::size_t Columns,
+          typename Lower, typename Rhs>
+inline constexpr void solve_lower(Lower &&lower, Rhs &&rhs) {
+  for (std::size_t c{0}; c < Columns; ++c) {
+    for (std::size_t i{0}; i < Size; ++i) {
+      Type value{rhs(i, c)};
+
+      for (std::size_t k{0}; k < i; ++k) {
+        value -= lower(i, k) * rhs(k, c);
+      }
+
+      rhs(i, c) = value / lower(i, i);
+    }
+  }
+}
+
+//! @brief In-place backward substitution solving `U * X = B`.
+template <typename Type, std::size_t Size, std::size_t Columns,
+          typename Upper, typename Rhs>
+inline constexpr void solve_upper(Upper &&upper, Rhs &&rhs) {
+  for (std::size_t c{0}; c < Columns; ++c) {
+    for (std::size_t i{Size}; i-- > 0;) {
+      Type value{rhs(i, c)};
+
+      for (std::size_t k{i + 1}; k < Size; ++k) {
+        value -= upper(i, k) * rhs(k, c);
+      }
+
+      rhs(i, c) = value / upper(i, i);
+    }
+  }
+}
+
+//! @brief Squared Mahalanobis distances of a block of residuals.
+//!
+//! @details Solves `L * X = Y` by forward substitution for the `Size x Columns`
+//! row-major residuals `Y` and returns the squared norms of the columns of the
+//! solution `X`, the distances `y^T * (L * L^T)^-1 * y` of each residual `y`.
+//! The innermost loops run across the contiguous columns for vectorization.
+template <typename Type, std::size_t Size, std::size_t Columns,
+          typename Lower>
+[[nodiscard]] inline constexpr std::array<Type, Columns>
+mahalanobis(Lower &&lower, std::array<Type, Size * Columns> residuals) {
+  std::array<Type, Columns> result{};
+
+  for (std::size_t i{0}; i < Size; ++i) {
+    for (std::size_t k{0}; k < i; ++k) {
+      const Type factor{lower(i, k)};
+
+      for (std::size_t c{0}; c < Columns; ++c) {
+        residuals[i * Columns + c] -= factor * residuals[k * Columns + c];
+      }
+    }
+
+    const Type inverse{Type{1} / lower(i, i)};
+
+    for (std::size_t c{0}; c < Columns; ++c) {
+      residuals[i * Columns + c] *= inverse;
+      result[c] += residuals[i * Columns + c] * residuals[i * Columns + c];
+    }
+  }
+
+  return result;
+}
+
+//! @brief In-place lower triangularization of a wide matrix.
+//!
+//! @details Orthogonal Givens rotations of the columns compute the `L` factor
+//! of the `L * Q` decomposition, the transposed `Q * R` decomposition, of the
+//! `Rows x Columns` matrix `A`, such that `A * A^T = L * L^T`. The leading
+//! square block is overwritten by the lower triangular factor with a
+//! non-negative diagonal, the remaining columns are zeroed.
+template <typename Type, std::size_t Rows, std::size_t Columns,
+          typename Matrix>
+inline constexpr void triangularize(Matrix &&matrix) {
+  static_assert(Rows <= Columns);
+
+  for (std::size_t i{0}; i < Rows; ++i) {
+    for (std::size_t j{i + 1}; j < Columns; ++j) {
+      const Type a{matrix(i, i)};
+      const Type b{matrix(i, j)};
+
+      if (b == Type{0}) {
+        continue;
+      }
+
+      const Type r{std::hypot(a, b)};
+      const Type c{a / r};
+      const Type s{b / r};
+
+      for (std::size_t k{i}; k < Rows; ++k) {
+        const Type x{matrix(k, i)};
+        const Type y{matrix(k, j)};
+
+        matrix(k, i) = c * x + s * y;
+        matrix(k, j) = c * y - s * x;
+      }
+    }
+
+    if (matrix(i, i) < Type{0}) {
+      for (std::size_t k{i}; k < Rows; ++k) {
+        matrix(k, i) = -matrix(k, i);
+      }
+    }
+  }
+}
+
+//! @brief Element accessor of the matrix, or of its transpose.
+template <bool Transposed, typename Matrix>
+[[nodiscard]] inline constexpr auto accessor(Matrix &matrix) {
+  return [&matrix](std::size_t row, std::size_t column) -> decltype(auto) {
+    if constexpr (Transposed) {
+      return matrix(column, row);
+    } else {
+      return matrix(row, column);
+    }
+  };
+}
+
+//! @}
+
+} // namespace fcarouge::typed_linear_algebra_internal
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_FACTORIZATION_HPP
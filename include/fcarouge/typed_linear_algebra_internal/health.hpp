@@ -0,0 +1,277 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_HEALTH_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_HEALTH_HPP
+
+#include "utility.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <string_view>
+#include <type_traits>
+
+namespace fcarouge::health {
+
+//! @name Constants
+//! @{
+
+//! @brief The health monitor of the typed operations is compiled in.
+//!
+//! @details Define `FCAROUGE_TYPED_LINEAR_ALGEBRA_HEALTH` to inspect the
+//! results of the typed operations. The monitor is compiled out by default:
+//! the operators are then free of any inspection overhead.
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_HEALTH
+inline constexpr bool enabled{true};
+#else
+inline constexpr bool enabled{false};
+#endif
+
+//! @}
+
+//! @name Types
+//! @{
+
+//! @brief The numerical faults of the result of a typed operation.
+struct diagnosis {
+  //! @brief The name of the typed operation.
+  std::string_view operation;
+
+  //! @brief The count of rows of the result.
+  std::size_t rows{0};
+
+  //! @brief The count of columns of the result.
+  std::size_t columns{0};
+
+  //! @brief An element is not a number or is infinite.
+  bool non_finite{false};
+
+  //! @brief The inspected covariance is asymmetric beyond the tolerance.
+  bool asymmetric{false};
+
+  //! @brief A diagonal element of the inspected covariance is negative.
+  bool negative_diagonal{false};
+};
+
+//! @brief The monitor of the faulty results.
+using monitor = void (*)(const diagnosis &value);
+
+//! @}
+
+} // namespace fcarouge::health
+
+namespace fcarouge::typed_linear_algebra_internal {
+
+//! @brief Linear algebra finiteness specialization point.
+//!
+//! @details Whether every element of the `Rows x Columns` matrix is finite.
+//! The elements are read in a single branchless pass.
+template <typename Type, std::size_t Rows, std::size_t Columns> struct finites {
+  [[nodiscard]] inline constexpr bool operator()(const Type &value) const {
+    bool result{true};
+
+    for (std::size_t j{0}; j < Columns; ++j) {
+      for (std::size_t i{0}; i < Rows; ++i) {
+        result &= std::isfinite(value(i, j));
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Linear algebra symmetry specialization point.
+//!
+//! @details Whether every pair of symmetric elements of the `Size x Size`
+//! matrix differ by at most the tolerance relative to their largest magnitude.
+template <typename Type, std::size_t Size> struct symmetrics {
+  [[nodiscard]] inline constexpr bool operator()(const Type &value,
+                                                 double tolerance) const {
+    bool result{true};
+
+    for (std::size_t j{0}; j < Size; ++j) {
+      for (std::size_t i{j + 1}; i < Size; ++i) {
+        const auto lower{value(i, j)};
+        const auto upper{value(j, i)};
+        const decltype(lower) bound{static_cast<decltype(lower)>(tolerance)};
+
+        result &= std::abs(upper - lower) <=
+                  bound * std::max(std::abs(upper), std::abs(lower));
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Linear algebra diagonal sign specialization point.
+//!
+//! @details Whether every diagonal element of the `Size x Size` matrix is not
+//! negative.
+template <typename Type, std::size_t Size> struct nonnegative_diagonals {
+  [[nodiscard]] inline constexpr bool operator()(const Type &value) const {
+    bool result{true};
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      result &= !(value(i, i) < 0);
+    }
+
+    return result;
+  }
+};
+
+//! @brief Prints the faults of a result to the standard error.
+inline void complain(const health::diagnosis &value) {
+  std::fputs(std::format("{} of {}x{}:{}{}{}\n", value.operation, value.rows,
+                         value.columns, value.non_finite ? " non-finite" : "",
+                         value.asymmetric ? " asymmetric" : "",
+                         value.negative_diagonal ? " negative diagonal" : "")
+                 .c_str(),
+             stderr);
+}
+
+//! @brief The monitor of the faulty results.
+inline std::atomic<health::monitor> monitored{complain};
+
+//! @brief The relative tolerance of the symmetry of the covariances.
+inline std::atomic<double> tolerance{1e-9};
+
+//! @brief Reports the faulty diagnosis to the monitor.
+inline void report(const health::diagnosis &value) {
+  if (value.non_finite || value.asymmetric || value.negative_diagonal) {
+    if (const health::monitor reporter{
+            monitored.load(std::memory_order_relaxed)}) {
+      reporter(value);
+    }
+  }
+}
+
+//! @brief Inspects the health of the result of a typed operation.
+//!
+//! @details Compiled out unless the health monitor is enabled. The finiteness
+//! of the elements is read in a single pass. The symmetry and the diagonal sign
+//! of the covariances are only inspected on request, the index types of a
+//! result do not tell a covariance from a transition or a product. The monitor
+//! is only called on faults.
+//!
+//! @param operation The name of the typed operation.
+//! @param value The typed result of the operation.
+template <typename TypedMatrix>
+inline constexpr void inspect([[maybe_unused]] std::string_view operation,
+                              [[maybe_unused]] const TypedMatrix &value) {
+  if constexpr (health::enabled) {
+    if !consteval {
+      constexpr std::size_t rows{TypedMatrix::rows};
+      constexpr std::size_t columns{TypedMatrix::columns};
+      health::diagnosis result{operation, rows, columns};
+
+      result.non_finite =
+          !finites<std::remove_cvref_t<decltype(value.data)>, rows, columns>{}(
+              value.data);
+
+      report(result);
+    }
+  }
+}
+
+} // namespace fcarouge::typed_linear_algebra_internal
+
+namespace fcarouge::health {
+
+//! @name Functions
+//! @{
+
+//! @brief Replaces the monitor of the faulty results.
+//!
+//! @details The default monitor prints the faults of the results to the
+//! standard error. A null monitor disables the reports. The monitor is stored
+//! in every build, it is only called when the health monitor is enabled.
+inline void monitor_with(monitor value) {
+  typed_linear_algebra_internal::monitored.store(value,
+                                                 std::memory_order_relaxed);
+}
+
+//! @brief Replaces the relative tolerance of the symmetry of the covariances.
+//!
+//! @details The symmetric elements of an inspected covariance differ by at most
+//! the tolerance relative to their largest magnitude. The default
+//! tolerance is `1e-9`. The tolerance applies in every build, the inspections
+//! of the covariances are always available.
+inline void tolerate(double value) {
+  typed_linear_algebra_internal::tolerance.store(value,
+                                                 std::memory_order_relaxed);
+}
+
+//! @brief Inspects the health of a covariance.
+//!
+//! @details The finiteness of the elements, the symmetry within the tolerance,
+//! and the sign of the diagonal of the square typed matrix are checked on
+//! request, wherever the typed matrix is known to be a covariance. The faults
+//! are reported to the monitor when it is enabled.
+//!
+//! @param value The square typed matrix of the covariance.
+//! @param operation The name of the inspection in the diagnosis.
+//!
+//! @return The diagnosis of the covariance.
+template <typename TypedMatrix>
+  requires(TypedMatrix::rows == TypedMatrix::columns)
+inline diagnosis inspect_covariance(const TypedMatrix &value,
+                                    std::string_view operation = "covariance") {
+  namespace tla = typed_linear_algebra_internal;
+  using storage = std::remove_cvref_t<decltype(value.data)>;
+  constexpr std::size_t size{TypedMatrix::rows};
+
+  const diagnosis result{
+      .operation = operation,
+      .rows = size,
+      .columns = size,
+      .non_finite = !tla::finites<storage, size, size>{}(value.data),
+      .asymmetric = !tla::symmetrics<storage, size>{}(
+          value.data, tla::tolerance.load(std::memory_order_relaxed)),
+      .negative_diagonal =
+          !tla::nonnegative_diagonals<storage, size>{}(value.data)};
+
+  if constexpr (enabled) {
+    tla::report(result);
+  }
+
+  return result;
+}
+
+//! @}
+
+} // namespace fcarouge::health
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_HEALTH_HPP
@@ -0,0 +1,334 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_INSTRUMENTATION_HPP
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_INSTRUMENTATION_HPP
+
+#include "utility.hpp"
+
+#include <cstdint>
+#include <source_location>
+#include <string_view>
+
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+#include <atomic>
+#include <cstdio>
+#include <deque>
+#include <format>
+#include <mutex>
+#include <string>
+#endif
+
+namespace fcarouge::instrumentation {
+
+//! @name Constants
+//! @{
+
+//! @brief The instrumentation of the typed operations is compiled in.
+//!
+//! @details Define `FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION` to count the
+//! work of the typed operations. The instrumentation is compiled out by
+//! default: the operators are then free of any counting overhead, the sites
+//! and scopes are empty, and the registry of the sites and its standard headers
+//! are not compiled.
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+inline constexpr bool enabled{true};
+#else
+inline constexpr bool enabled{false};
+#endif
+
+//! @}
+
+//! @name Types
+//! @{
+
+//! @brief The work counters of the typed operations.
+//!
+//! @details The floating point operations and the bytes are estimates from the
+//! textbook dense algorithms, not hardware measurements.
+struct counters {
+  //! @brief The count of typed operations.
+  std::uint64_t operations{0};
+
+  //! @brief The estimated count of floating point operations.
+  std::uint64_t flops{0};
+
+  //! @brief The count of evaluated temporary matrices.
+  std::uint64_t temporaries{0};
+
+  //! @brief The count of matrix decompositions.
+  std::uint64_t decompositions{0};
+
+  //! @brief The count of evaluations allocating dynamic memory.
+  std::uint64_t allocations{0};
+
+  //! @brief The estimated count of bytes read and written.
+  std::uint64_t bytes{0};
+};
+
+//! @brief The reporter of the counters of a site.
+using reporter = void (*)(std::string_view name,
+                          const std::source_location &location,
+                          const counters &value);
+
+//! @}
+
+} // namespace fcarouge::instrumentation
+
+namespace fcarouge::typed_linear_algebra_internal {
+
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+//! @brief The accumulated counters of a site.
+//!
+//! @details The counters are relaxed atomics for the typed operations of
+//! concurrent threads to accumulate in the same site.
+struct probe {
+  std::string name;
+  std::source_location location;
+  std::atomic<std::uint64_t> operations{0};
+  std::atomic<std::uint64_t> flops{0};
+  std::atomic<std::uint64_t> temporaries{0};
+  std::atomic<std::uint64_t> decompositions{0};
+  std::atomic<std::uint64_t> allocations{0};
+  std::atomic<std::uint64_t> bytes{0};
+
+  inline void add(const instrumentation::counters &value) noexcept {
+    operations.fetch_add(value.operations, std::memory_order_relaxed);
+    flops.fetch_add(value.flops, std::memory_order_relaxed);
+    temporaries.fetch_add(value.temporaries, std::memory_order_relaxed);
+    decompositions.fetch_add(value.decompositions, std::memory_order_relaxed);
+    allocations.fetch_add(value.allocations, std::memory_order_relaxed);
+    bytes.fetch_add(value.bytes, std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] inline instrumentation::counters load() const noexcept {
+    return {operations.load(std::memory_order_relaxed),
+            flops.load(std::memory_order_relaxed),
+            temporaries.load(std::memory_order_relaxed),
+            decompositions.load(std::memory_order_relaxed),
+            allocations.load(std::memory_order_relaxed),
+            bytes.load(std::memory_order_relaxed)};
+  }
+};
+
+//! @brief Prints the non-empty counters of a site to the standard error.
+inline void dump(std::string_view name, const std::source_location &location,
+                 const instrumentation::counters &value) {
+  if (value.operations == 0) {
+    return;
+  }
+
+  std::fputs(std::format("{}:{}: {}: {} operations, {} flops, {} temporaries, "
+                         "{} decompositions, {} allocations, {} bytes\n",
+                         location.file_name(), location.line(), name,
+                         value.operations, value.flops, value.temporaries,
+                         value.decompositions, value.allocations, value.bytes)
+                 .c_str(),
+             stderr);
+}
+
+//! @brief The registry of the probes of the sites.
+//!
+//! @details The probes are owned by the registry, in registration order, and
+//! live until the exit of the program where they are reported.
+struct registry {
+  std::mutex mutex;
+  std::deque<probe> probes;
+  instrumentation::reporter reporter{dump};
+
+  inline ~registry() {
+    if (reporter) {
+      for (const auto &value : probes) {
+        reporter(value.name, value.location, value.load());
+      }
+    }
+  }
+};
+
+[[nodiscard]] inline registry &registered() {
+  static registry value;
+  return value;
+}
+
+[[nodiscard]] inline probe &enroll(std::string_view name,
+                                   const std::source_location &location) {
+  registry &value{registered()};
+  const std::lock_guard lock{value.mutex};
+  return value.probes.emplace_back(std::string{name}, location);
+}
+
+//! @brief The probe of the typed operations outside of any scope.
+[[nodiscard]] inline probe &unscoped() {
+  static probe &value{enroll("unscoped", std::source_location::current())};
+  return value;
+}
+
+//! @brief The probe of the innermost scope of the thread.
+inline thread_local probe *current{nullptr};
+
+inline void count(const instrumentation::counters &value) noexcept {
+  (current ? *current : unscoped()).add(value);
+}
+#else
+struct probe;
+#endif
+
+//! @brief Records the work of a typed operation.
+//!
+//! @details Compiled out unless the instrumentation is enabled. The evaluated
+//! temporary of the operation is of the `Matrix` storage type.
+//!
+//! @param flops The estimated count of floating point operations.
+//! @param elements The count of elements read and written.
+//! @param decompositions The count of matrix decompositions.
+template <typename Matrix>
+inline constexpr void
+record([[maybe_unused]] std::uint64_t flops,
+       [[maybe_unused]] std::uint64_t elements,
+       [[maybe_unused]] std::uint64_t decompositions = 0) {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+  if !consteval {
+    count({1, flops, 1, decompositions, allocates<Matrix>{}() ? 1U : 0U,
+           elements * sizeof(underlying_t<Matrix>)});
+  }
+#endif
+}
+
+} // namespace fcarouge::typed_linear_algebra_internal
+
+namespace fcarouge::instrumentation {
+
+//! @name Types
+//! @{
+
+//! @brief A named site accumulating the work of the typed operations.
+//!
+//! @details The typed operations of the scopes of the site are counted in the
+//! site, for example a filter stage. The counters of a site are reported at
+//! the exit of the program, even after the site is destroyed.
+class site {
+public:
+  //! @brief Registers the site.
+  //!
+  //! @param name The name of the site in the reports.
+  //! @param location The source location of the site in the reports.
+  inline explicit site(
+      [[maybe_unused]] std::string_view name,
+      [[maybe_unused]] const std::source_location &location =
+          std::source_location::current()) {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+    entry = &typed_linear_algebra_internal::enroll(name, location);
+#endif
+  }
+
+  site(const site &other) = delete;
+  site &operator=(const site &other) = delete;
+
+  //! @brief The counters accumulated so far.
+  [[nodiscard]] inline counters value() const noexcept {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+    return entry->load();
+#else
+    return {};
+#endif
+  }
+
+private:
+  friend class scope;
+
+  typed_linear_algebra_internal::probe *entry{nullptr};
+};
+
+//! @brief Counts the typed operations of the thread in the site.
+//!
+//! @details The scopes nest, the innermost scope of the thread counts the
+//! typed operations until its destruction.
+class scope {
+public:
+  inline explicit scope([[maybe_unused]] site &value) noexcept {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+    previous = typed_linear_algebra_internal::current;
+    typed_linear_algebra_internal::current = value.entry;
+#endif
+  }
+
+  scope(const scope &other) = delete;
+  scope &operator=(const scope &other) = delete;
+
+  inline ~scope() {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+    typed_linear_algebra_internal::current = previous;
+#endif
+  }
+
+private:
+  typed_linear_algebra_internal::probe *previous{nullptr};
+};
+
+//! @}
+
+//! @name Functions
+//! @{
+
+//! @brief Visits the counters of every site, in registration order.
+//!
+//! @details The visitor is called with the name, the source location, and the
+//! counters of the site. The typed operations outside of any scope are counted
+//! in the `unscoped` site.
+template <typename Visitor>
+inline void report([[maybe_unused]] Visitor &&visitor) {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+  auto &value{typed_linear_algebra_internal::registered()};
+  const std::lock_guard lock{value.mutex};
+
+  for (const auto &probe : value.probes) {
+    visitor(std::string_view{probe.name}, probe.location, probe.load());
+  }
+#endif
+}
+
+//! @brief Replaces the reporter of the counters at exit.
+//!
+//! @details The default reporter prints the counters of the sites with typed
+//! operations to the standard error. A null reporter disables the report.
+inline void report_at_exit([[maybe_unused]] reporter value) {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+  auto &registry{typed_linear_algebra_internal::registered()};
+  const std::lock_guard lock{registry.mutex};
+  registry.reporter = value;
+#endif
+}
+
+//! @}
+
+} // namespace fcarouge::instrumentation
+
+#endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_INSTRUMENTATION_HPP
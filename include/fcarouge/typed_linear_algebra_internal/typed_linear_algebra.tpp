@@ -49,8 +49,86 @@ template <typename Matrix1, typename Matrix2, typename RowIndexes,
 [[nodiscard]] inline constexpr auto
 operator*(const typed_matrix<Matrix1, RowIndexes, Indexes> &lhs,
           const typed_matrix<Matrix2, Indexes, ColumnIndexes> &rhs) {
-  return typed_matrix<tla::evaluate<tla::product<Matrix1, Matrix2>>, RowIndexes,
-                      ColumnIndexes>{lhs.data * rhs.data};
+  constexpr std::uint64_t rows{tla::size<RowIndexes>};
+  constexpr std::uint64_t columns{tla::size<ColumnIndexes>};
+  constexpr std::uint64_t inner{tla::size<Indexes>};
+
+  tla::record<tla::evaluate<tla::product<Matrix1, Matrix2>>>(
+      2 * rows * inner * columns,
+      rows * inner + inner * columns + rows * columns);
+
+  using result = tla::evaluate<tla::product<Matrix1, Matrix2>>;
+
+  typed_matrix<result, RowIndexes, ColumnIndexes> value{
+      tla::multiply<result>(lhs.data, rhs.data)};
+
+  tla::inspect("product", value);
+
+  return tla::decay(std::move(value));
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*([[maybe_unused]] identity_matrix<
+              typed_matrix<Matrix1, RowIndexes, Indexes>>
+              lhs,
+          const typed_matrix<Matrix2, Indexes, ColumnIndexes> &rhs) {
+  return tla::decay(
+      typed_matrix<tla::evaluate<Matrix2>, RowIndexes, ColumnIndexes>{
+          rhs.data});
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_matrix<Matrix1, RowIndexes, Indexes> &lhs,
+          [[maybe_unused]] identity_matrix<
+              typed_matrix<Matrix2, Indexes, ColumnIndexes>>
+              rhs) {
+  return tla::decay(
+      typed_matrix<tla::evaluate<Matrix1>, RowIndexes, ColumnIndexes>{
+          lhs.data});
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*([[maybe_unused]] identity_matrix<
+              typed_matrix<Matrix1, RowIndexes, Indexes>>
+              lhs,
+          [[maybe_unused]] identity_matrix<
+              typed_matrix<Matrix2, Indexes, ColumnIndexes>>
+              rhs) {
+  return identity_matrix<
+      typed_matrix<tla::evaluate<tla::product<Matrix1, Matrix2>>, RowIndexes,
+                   ColumnIndexes>>{};
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*([[maybe_unused]] zero_matrix<
+              typed_matrix<Matrix1, RowIndexes, Indexes>>
+              lhs,
+          [[maybe_unused]] const typed_matrix<Matrix2, Indexes, ColumnIndexes>
+              &rhs) {
+  return zero_matrix<
+      typed_matrix<tla::evaluate<tla::product<Matrix1, Matrix2>>, RowIndexes,
+                   ColumnIndexes>>{};
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*([[maybe_unused]] const typed_matrix<Matrix1, RowIndexes, Indexes>
+              &lhs,
+          [[maybe_unused]] zero_matrix<
+              typed_matrix<Matrix2, Indexes, ColumnIndexes>>
+              rhs) {
+  return zero_matrix<
+      typed_matrix<tla::evaluate<tla::product<Matrix1, Matrix2>>, RowIndexes,
+                   ColumnIndexes>>{};
 }
 
 template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
@@ -65,8 +143,17 @@ template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
 [[nodiscard]] inline constexpr auto
 operator*(Scalar lhs,
           const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &rhs) {
-  return typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
-      lhs * rhs.data};
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size, 2 * size);
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes> value{
+      tla::multiply<tla::evaluate<Matrix>>(lhs, rhs.data)};
+
+  tla::inspect("scaling", value);
+
+  return value;
 }
 
 template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
@@ -83,8 +170,17 @@ template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
 [[nodiscard]] inline constexpr auto
 operator*(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &lhs,
           Scalar rhs) {
-  return typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
-      lhs.data * rhs};
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size, 2 * size);
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes> value{
+      tla::multiply<tla::evaluate<Matrix>>(lhs.data, rhs)};
+
+  tla::inspect("scaling", value);
+
+  return value;
 }
 
 template <typename Matrix1, typename Matrix2, typename RowIndexes,
@@ -92,8 +188,39 @@ template <typename Matrix1, typename Matrix2, typename RowIndexes,
 [[nodiscard]] inline constexpr auto
 operator+(const typed_matrix<Matrix1, RowIndexes, ColumnIndexes> &lhs,
           const typed_matrix<Matrix2, RowIndexes, ColumnIndexes> &rhs) {
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix1>>(size, 3 * size);
+
+  typed_matrix<tla::evaluate<Matrix1>, RowIndexes, ColumnIndexes> value{
+      tla::add<tla::evaluate<Matrix1>>(lhs.data, rhs.data)};
+
+  tla::inspect("sum", value);
+
+  return value;
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator+(const typed_matrix<Matrix1, RowIndexes, ColumnIndexes> &lhs,
+          [[maybe_unused]] zero_matrix<
+              typed_matrix<Matrix2, RowIndexes, ColumnIndexes>>
+              rhs) {
   return typed_matrix<tla::evaluate<Matrix1>, RowIndexes, ColumnIndexes>{
-      lhs.data + rhs.data};
+      lhs.data};
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator+([[maybe_unused]] zero_matrix<
+              typed_matrix<Matrix1, RowIndexes, ColumnIndexes>>
+              lhs,
+          const typed_matrix<Matrix2, RowIndexes, ColumnIndexes> &rhs) {
+  return typed_matrix<tla::evaluate<Matrix2>, RowIndexes, ColumnIndexes>{
+      rhs.data};
 }
 
 template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
@@ -109,8 +236,28 @@ template <typename Matrix1, typename Matrix2, typename RowIndexes,
 [[nodiscard]] inline constexpr auto
 operator-(const typed_matrix<Matrix1, RowIndexes, ColumnIndexes> &lhs,
           const typed_matrix<Matrix2, RowIndexes, ColumnIndexes> &rhs) {
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix1>>(size, 3 * size);
+
+  typed_matrix<tla::evaluate<Matrix1>, RowIndexes, ColumnIndexes> value{
+      tla::subtract<tla::evaluate<Matrix1>>(lhs.data, rhs.data)};
+
+  tla::inspect("difference", value);
+
+  return value;
+}
+
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator-(const typed_matrix<Matrix1, RowIndexes, ColumnIndexes> &lhs,
+          [[maybe_unused]] zero_matrix<
+              typed_matrix<Matrix2, RowIndexes, ColumnIndexes>>
+              rhs) {
   return typed_matrix<tla::evaluate<Matrix1>, RowIndexes, ColumnIndexes>{
-      lhs.data - rhs.data};
+      lhs.data};
 }
 
 template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
@@ -125,8 +272,28 @@ template <typename Matrix1, typename Matrix2, typename RowIndexes1,
 [[nodiscard]] inline constexpr auto
 operator/(const typed_matrix<Matrix1, RowIndexes1, ColumnIndexes> &lhs,
           const typed_matrix<Matrix2, RowIndexes2, ColumnIndexes> &rhs) {
-  return typed_matrix<tla::evaluate<tla::quotient<Matrix1, Matrix2>>,
-                      RowIndexes1, RowIndexes2>{lhs.data / rhs.data};
+  constexpr std::uint64_t rows{tla::size<RowIndexes1>};
+  constexpr std::uint64_t size{tla::size<RowIndexes2>};
+  constexpr std::uint64_t columns{tla::size<ColumnIndexes>};
+  constexpr std::uint64_t long_side{std::max(size, columns)};
+  constexpr std::uint64_t short_side{std::min(size, columns)};
+
+  //! The estimate is of a Householder QR decomposition of the
+  //! transposed `C x R2` denominator and of the solution of its `R1` columns.
+  tla::record<tla::evaluate<tla::quotient<Matrix1, Matrix2>>>(
+      2 * long_side * short_side * short_side -
+          2 * short_side * short_side * short_side / 3 +
+          rows * (4 * columns * size + size * size),
+      rows * columns + size * columns + rows * size, 1);
+
+  using result = tla::evaluate<tla::quotient<Matrix1, Matrix2>>;
+
+  typed_matrix<result, RowIndexes1, RowIndexes2> value{
+      tla::divide<result>(lhs.data, rhs.data)};
+
+  tla::inspect("division", value);
+
+  return tla::decay(std::move(value));
 }
 
 template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
@@ -134,8 +301,17 @@ template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
 [[nodiscard]] inline constexpr auto
 operator/(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &lhs,
           Scalar rhs) {
-  return typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
-      lhs.data / rhs};
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size, 2 * size);
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes> value{
+      tla::divide<tla::evaluate<Matrix>>(lhs.data, rhs)};
+
+  tla::inspect("scaling", value);
+
+  return value;
 }
 
 template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
@@ -144,6 +320,1481 @@ template <tla::arithmetic Scalar, typename Matrix, typename RowIndexes,
 [[nodiscard]] inline constexpr auto operator/(const Matrix &lhs, Scalar rhs) {
   return tla::element<Matrix, 0, 0>{lhs.data(0) / rhs};
 }
+
+//! @brief Transposes the typed matrix.
+//!
+//! @details The transposition of a named typed matrix is a lazy view on the
+//! operand when the backend supports it. The transposition of a transposed
+//! view is simplified back to the original storage at compile time.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+transpose(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  return typed_matrix<tla::transpose<Matrix>, ColumnIndexes, RowIndexes>{
+      tla::transposes<Matrix>{}(value.data)};
+}
+
+//! @brief Transposes the temporary typed matrix.
+//!
+//! @details The temporary operand does not outlive the expression, the
+//! transposition is evaluated.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+transpose(typed_matrix<Matrix, RowIndexes, ColumnIndexes> &&value) {
+  tla::record<tla::evaluate<tla::transpose<Matrix>>>(
+      0, 2 * tla::size<RowIndexes> * tla::size<ColumnIndexes>);
+
+  return typed_matrix<tla::evaluate<tla::transpose<Matrix>>, ColumnIndexes,
+                      RowIndexes>{tla::transposes<Matrix>{}(value.data)};
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto transpose(
+    [[maybe_unused]] identity_matrix<
+        typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+        value) {
+  return identity_matrix<
+      typed_matrix<tla::evaluate<tla::transpose<Matrix>>, ColumnIndexes,
+                   RowIndexes>>{};
+}
+
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+transpose([[maybe_unused]] zero_matrix<
+          typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+              value) {
+  return zero_matrix<typed_matrix<tla::evaluate<tla::transpose<Matrix>>,
+                                  ColumnIndexes, RowIndexes>>{};
+}
+
+template <typename Vector1, typename Vector2, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr bool operator==(
+    const typed_diagonal_matrix<Vector1, RowIndexes, ColumnIndexes> &lhs,
+    const typed_diagonal_matrix<Vector2, RowIndexes, ColumnIndexes> &rhs) {
+  return lhs.data == rhs.data;
+}
+
+//! @brief Row scaling product of a diagonal by a dense typed matrix.
+template <typename Vector, typename Matrix, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_diagonal_matrix<Vector, RowIndexes, Indexes> &lhs,
+          const typed_matrix<Matrix, Indexes, ColumnIndexes> &rhs) {
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size,
+                                     tla::size<RowIndexes> + 2 * size);
+
+  return tla::decay(
+      typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
+          tla::scale_rows<tla::evaluate<Matrix>, tla::size<RowIndexes>,
+                          tla::size<ColumnIndexes>>(lhs.data, rhs.data)});
+}
+
+//! @brief Column scaling product of a dense typed matrix by a diagonal.
+template <typename Matrix, typename Vector, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_matrix<Matrix, RowIndexes, Indexes> &lhs,
+          const typed_diagonal_matrix<Vector, Indexes, ColumnIndexes> &rhs) {
+  constexpr std::uint64_t size{tla::size<RowIndexes> *
+                               tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size,
+                                     tla::size<ColumnIndexes> + 2 * size);
+
+  return tla::decay(
+      typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
+          tla::scale_columns<tla::evaluate<Matrix>, tla::size<RowIndexes>,
+                             tla::size<ColumnIndexes>>(lhs.data, rhs.data)});
+}
+
+template <typename Vector1, typename Vector2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_diagonal_matrix<Vector1, RowIndexes, Indexes> &lhs,
+          const typed_diagonal_matrix<Vector2, Indexes, ColumnIndexes> &rhs) {
+  tla::record<tla::evaluate<Vector1>>(tla::size<RowIndexes>,
+                                      3 * tla::size<RowIndexes>);
+
+  typed_diagonal_matrix<tla::evaluate<Vector1>, RowIndexes, ColumnIndexes>
+      result{lhs.data};
+
+  for (std::size_t i{0}; i < tla::size<RowIndexes>; ++i) {
+    result.data(i) *= rhs.data(i);
+  }
+
+  return result;
+}
+
+template <typename Matrix, typename Vector, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator+(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &lhs,
+          const typed_diagonal_matrix<Vector, RowIndexes, ColumnIndexes> &rhs) {
+  tla::record<tla::evaluate<Matrix>>(
+      tla::size<RowIndexes>,
+      tla::size<RowIndexes> +
+          2 * tla::size<RowIndexes> * tla::size<ColumnIndexes>);
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes> result{
+      lhs.data};
+
+  for (std::size_t i{0}; i < tla::size<RowIndexes>; ++i) {
+    result.data(i, i) += rhs.data(i);
+  }
+
+  return result;
+}
+
+template <typename Vector, typename Matrix, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator+(const typed_diagonal_matrix<Vector, RowIndexes, ColumnIndexes> &lhs,
+          const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &rhs) {
+  return rhs + lhs;
+}
+
+template <typename Vector1, typename Vector2, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto operator+(
+    const typed_diagonal_matrix<Vector1, RowIndexes, ColumnIndexes> &lhs,
+    const typed_diagonal_matrix<Vector2, RowIndexes, ColumnIndexes> &rhs) {
+  tla::record<tla::evaluate<Vector1>>(tla::size<RowIndexes>,
+                                      3 * tla::size<RowIndexes>);
+
+  return typed_diagonal_matrix<tla::evaluate<Vector1>, RowIndexes,
+                               ColumnIndexes>{lhs.data + rhs.data};
+}
+
+template <typename Matrix, typename Vector, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator-(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &lhs,
+          const typed_diagonal_matrix<Vector, RowIndexes, ColumnIndexes> &rhs) {
+  tla::record<tla::evaluate<Matrix>>(
+      tla::size<RowIndexes>,
+      tla::size<RowIndexes> +
+          2 * tla::size<RowIndexes> * tla::size<ColumnIndexes>);
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes> result{
+      lhs.data};
+
+  for (std::size_t i{0}; i < tla::size<RowIndexes>; ++i) {
+    result.data(i, i) -= rhs.data(i);
+  }
+
+  return result;
+}
+
+//! @brief Division of a dense typed matrix by a diagonal.
+//!
+//! @details The solution is a column scaling by the reciprocal diagonal
+//! elements, no decomposition is involved. Dividing an `R1 x C` matrix by an
+//! `R2 x C` diagonal matrix results in an `R1 x R2` matrix.
+template <typename Matrix, typename Vector, typename RowIndexes1,
+          typename RowIndexes2, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto operator/(
+    const typed_matrix<Matrix, RowIndexes1, ColumnIndexes> &lhs,
+    const typed_diagonal_matrix<Vector, RowIndexes2, ColumnIndexes> &rhs) {
+  constexpr std::uint64_t size{tla::size<RowIndexes1> *
+                               tla::size<RowIndexes2>};
+
+  tla::record<tla::evaluate<Matrix>>(size,
+                                     tla::size<RowIndexes2> + 2 * size);
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes1, RowIndexes2> result{
+      lhs.data};
+
+  for (std::size_t j{0}; j < tla::size<RowIndexes2>; ++j) {
+    for (std::size_t i{0}; i < tla::size<RowIndexes1>; ++i) {
+      result.data(i, j) /= rhs.data(j);
+    }
+  }
+
+  return tla::decay(result);
+}
+
+template <typename Vector1, typename Vector2, typename RowIndexes1,
+          typename RowIndexes2, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto operator/(
+    const typed_diagonal_matrix<Vector1, RowIndexes1, ColumnIndexes> &lhs,
+    const typed_diagonal_matrix<Vector2, RowIndexes2, ColumnIndexes> &rhs) {
+  tla::record<tla::evaluate<Vector1>>(tla::size<RowIndexes1>,
+                                      3 * tla::size<RowIndexes1>);
+
+  typed_diagonal_matrix<tla::evaluate<Vector1>, RowIndexes1, RowIndexes2>
+      result{lhs.data};
+
+  for (std::size_t i{0}; i < tla::size<RowIndexes1>; ++i) {
+    result.data(i) /= rhs.data(i);
+  }
+
+  return result;
+}
+
+//! @brief Inverts the typed diagonal matrix.
+//!
+//! @details The inverse diagonal elements are the reciprocals of the diagonal
+//! elements. The row indexes of the inverse are the reciprocals of the column
+//! indexes of the operand, and vice versa, for the inverse elements to be of
+//! the reciprocal types.
+template <typename Vector, typename RowIndexes, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+inverse(const typed_diagonal_matrix<Vector, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Vector>;
+
+  tla::record<tla::evaluate<Vector>>(tla::size<RowIndexes>,
+                                     2 * tla::size<RowIndexes>);
+
+  typed_diagonal_matrix<tla::evaluate<Vector>,
+                        tla::reciprocal_indexes<ColumnIndexes>,
+                        tla::reciprocal_indexes<RowIndexes>>
+      result{value.data};
+
+  for (std::size_t i{0}; i < tla::size<RowIndexes>; ++i) {
+    result.data(i) = underlying{1} / value.data(i);
+  }
+
+  return result;
+}
+
+//! @brief Cholesky factorization of the typed matrix.
+//!
+//! @details The typed matrix is read as symmetric from the triangle named by
+//! `Part`, the other triangle is ignored.
+//!
+//! @tparam Part The triangle read and of the resulting factor.
+//!
+//! @return The factor, or no value if the typed matrix is not positive
+//! definite.
+template <triangle Part = triangle::lower, typename Matrix, typename RowIndexes,
+          typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+cholesky(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value)
+    -> std::optional<typed_triangular_factor<tla::evaluate<Matrix>, RowIndexes,
+                                             ColumnIndexes, Part>> {
+  using underlying = tla::underlying_t<Matrix>;
+  constexpr std::uint64_t size{tla::size<RowIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size * size * size / 3, 2 * size * size,
+                                     1);
+
+  typed_triangular_factor<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes,
+                          Part>
+      result{value.data};
+
+  if (!tla::cholesky<underlying, size>(result.lower())) {
+    return std::nullopt;
+  }
+
+  return result;
+}
+
+//! @brief Reconstructs the typed matrix of the factor.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes,
+          triangle Part>
+[[nodiscard]] inline constexpr auto reconstruct(
+    const typed_triangular_factor<Matrix, RowIndexes, ColumnIndexes, Part>
+        &value) {
+  constexpr std::uint64_t size{tla::size<RowIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(2 * size * size * size, 2 * size * size);
+
+  if constexpr (Part == triangle::lower) {
+    return typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
+        tla::multiply<tla::evaluate<Matrix>>(
+            value.data, tla::transposes<Matrix>{}(value.data))};
+  } else {
+    return typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes>{
+        tla::multiply<tla::evaluate<Matrix>>(
+            tla::transposes<Matrix>{}(value.data), value.data)};
+  }
+}
+
+//! @brief Solves `L * X = B` by forward substitution.
+//!
+//! @details The lower triangular matrix `L` is the lower factor, or the
+//! transposed upper factor, of the factorization. The solution is computed in
+//! `O(n^2)` operations per column of `B` and keeps the index types of `B`.
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes1, typename ColumnIndexes2, triangle Part>
+[[nodiscard]] inline constexpr auto solve_lower(
+    const typed_triangular_factor<Matrix1, RowIndexes, ColumnIndexes1, Part>
+        &factor,
+    const typed_matrix<Matrix2, RowIndexes, ColumnIndexes2> &rhs) {
+  using underlying = tla::underlying_t<Matrix2>;
+  constexpr std::uint64_t size{tla::size<RowIndexes>};
+  constexpr std::uint64_t columns{tla::size<ColumnIndexes2>};
+
+  tla::record<tla::evaluate<Matrix2>>(size * size * columns,
+                                      size * size + 2 * size * columns);
+
+  typed_matrix<tla::evaluate<Matrix2>, RowIndexes, ColumnIndexes2> result{
+      rhs.data};
+
+  tla::solve_lower<underlying, tla::size<RowIndexes>,
+                   tla::size<ColumnIndexes2>>(
+      factor.lower(), tla::accessor<false>(result.data));
+
+  return result;
+}
+
+//! @brief Solves `U * X = B` by backward substitution.
+//!
+//! @details The upper triangular matrix `U` is the upper factor, or the
+//! transposed lower factor, of the factorization. The solution is computed in
+//! `O(n^2)` operations per column of `B` and keeps the index types of `B`.
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes1, typename ColumnIndexes2, triangle Part>
+[[nodiscard]] inline constexpr auto solve_upper(
+    const typed_triangular_factor<Matrix1, RowIndexes, ColumnIndexes1, Part>
+        &factor,
+    const typed_matrix<Matrix2, RowIndexes, ColumnIndexes2> &rhs) {
+  using underlying = tla::underlying_t<Matrix2>;
+  constexpr std::uint64_t size{tla::size<RowIndexes>};
+  constexpr std::uint64_t columns{tla::size<ColumnIndexes2>};
+
+  tla::record<tla::evaluate<Matrix2>>(size * size * columns,
+                                      size * size + 2 * size * columns);
+
+  typed_matrix<tla::evaluate<Matrix2>, RowIndexes, ColumnIndexes2> result{
+      rhs.data};
+
+  tla::solve_upper<underlying, tla::size<RowIndexes>,
+                   tla::size<ColumnIndexes2>>(
+      factor.upper(), tla::accessor<false>(result.data));
+
+  return result;
+}
+
+//! @brief Square-root propagation of a lower factor.
+//!
+//! @details Computes the lower factor of the typed matrix `F * P * F^T + Q`
+//! from the lower factors of `P` and `Q` without forming nor re-factoring the
+//! propagated matrix. The compound matrix `[F * L_P, L_Q]` is lower
+//! triangularized by orthogonal Givens rotations, its `Q * R` decomposition.
+//! The resulting factor keeps the index types of the `Q` factor.
+template <typename Matrix1, typename Matrix2, typename Matrix3,
+          typename RowIndexes1, typename ColumnIndexes1, typename RowIndexes2,
+          typename ColumnIndexes2>
+  requires tla::same_size<RowIndexes1, RowIndexes2>
+[[nodiscard]] inline constexpr auto
+propagate(const typed_triangular_factor<Matrix1, RowIndexes1, ColumnIndexes1,
+                                        triangle::lower> &factor,
+          const typed_matrix<Matrix2, RowIndexes2, RowIndexes1> &transition,
+          const typed_triangular_factor<Matrix3, RowIndexes2, ColumnIndexes2,
+                                        triangle::lower> &noise) {
+  using underlying = tla::underlying_t<Matrix3>;
+  constexpr std::size_t size{tla::size<RowIndexes2>};
+
+  //! The estimate is of the product and of the Givens triangularization of
+  //! the `n x 2n` compound matrix.
+  tla::record<tla::evaluate<Matrix3>>(7 * size * size * size,
+                                      4 * size * size, 1);
+
+  typed_triangular_factor<tla::evaluate<Matrix3>, RowIndexes2, ColumnIndexes2,
+                          triangle::lower>
+      result{tla::multiply<tla::evaluate<Matrix3>>(transition.data,
+                                                   factor.data)};
+  tla::evaluate<Matrix3> work{noise.data};
+
+  tla::triangularize<underlying, size, 2 * size>(
+      [&result, &work](std::size_t row, std::size_t column) -> underlying & {
+        return column < size ? result.data(row, column)
+                             : work(row, column - size);
+      });
+
+  return result;
+}
+
+//! @brief Block-wise product of a block diagonal by a dense typed matrix.
+//!
+//! @details Each block multiplies its own rows of the dense typed matrix, the
+//! off-diagonal zero blocks are skipped.
+template <typename... Matrices, typename... RowIndexes,
+          typename... ColumnIndexes, typename Matrix, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_block_diagonal_matrix<
+              typed_matrix<Matrices, RowIndexes, ColumnIndexes>...> &lhs,
+          const typed_matrix<Matrix, tla::concatenate<ColumnIndexes...>,
+                             Indexes> &rhs) {
+  using result = tla::evaluate<Matrix>;
+  constexpr std::uint64_t columns{tla::size<Indexes>};
+  constexpr std::uint64_t squares{
+      ((tla::size<RowIndexes> * tla::size<RowIndexes>) + ...)};
+
+  tla::record<result>(2 * squares * columns,
+                      squares + 2 * (tla::size<RowIndexes> + ...) * columns);
+
+  typed_matrix<result, tla::concatenate<RowIndexes...>, Indexes> value{
+      rhs.data};
+
+  lhs.for_each_block([&value, &rhs](const auto &block, std::size_t offset) {
+    constexpr std::size_t size{std::remove_cvref_t<decltype(block)>::rows};
+    using part = tla::resize<result, size, tla::size<Indexes>>;
+
+    tla::place<size, tla::size<Indexes>>(
+        value.data,
+        tla::multiply<part>(block.data,
+                            tla::slice<part, size, tla::size<Indexes>>(
+                                rhs.data, offset, 0)),
+        offset, 0);
+  });
+
+  tla::inspect("product", value);
+
+  return tla::decay(std::move(value));
+}
+
+//! @brief Block-wise product of a dense typed matrix by a block diagonal.
+//!
+//! @details Each block multiplies its own columns of the dense typed matrix,
+//! the off-diagonal zero blocks are skipped.
+template <typename Matrix, typename Indexes, typename... Matrices,
+          typename... RowIndexes, typename... ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_matrix<Matrix, Indexes, tla::concatenate<RowIndexes...>>
+              &lhs,
+          const typed_block_diagonal_matrix<
+              typed_matrix<Matrices, RowIndexes, ColumnIndexes>...> &rhs) {
+  using result = tla::evaluate<Matrix>;
+  constexpr std::uint64_t rows{tla::size<Indexes>};
+  constexpr std::uint64_t squares{
+      ((tla::size<RowIndexes> * tla::size<RowIndexes>) + ...)};
+
+  tla::record<result>(2 * rows * squares,
+                      squares + 2 * rows * (tla::size<RowIndexes> + ...));
+
+  typed_matrix<result, Indexes, tla::concatenate<ColumnIndexes...>> value{
+      lhs.data};
+
+  rhs.for_each_block([&value, &lhs](const auto &block, std::size_t offset) {
+    constexpr std::size_t size{std::remove_cvref_t<decltype(block)>::rows};
+    using part = tla::resize<result, tla::size<Indexes>, size>;
+
+    tla::place<tla::size<Indexes>, size>(
+        value.data,
+        tla::multiply<part>(tla::slice<part, tla::size<Indexes>, size>(
+                                lhs.data, 0, offset),
+                            block.data),
+        0, offset);
+  });
+
+  tla::inspect("product", value);
+
+  return tla::decay(std::move(value));
+}
+
+//! @brief Block-wise division of a dense typed matrix by a block diagonal.
+//!
+//! @details Each block solves its own columns of the dense typed matrix.
+//! Dividing an `R1 x C` matrix by a `R2 x C` block diagonal matrix results in
+//! an `R1 x R2` matrix.
+template <typename Matrix, typename Indexes, typename... Matrices,
+          typename... RowIndexes, typename... ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+operator/(const typed_matrix<Matrix, Indexes,
+                             tla::concatenate<ColumnIndexes...>> &lhs,
+          const typed_block_diagonal_matrix<
+              typed_matrix<Matrices, RowIndexes, ColumnIndexes>...> &rhs) {
+  using result = tla::evaluate<Matrix>;
+  constexpr std::uint64_t rows{tla::size<Indexes>};
+  constexpr std::uint64_t squares{
+      ((tla::size<RowIndexes> * tla::size<RowIndexes>) + ...)};
+  constexpr std::uint64_t cubes{((tla::size<RowIndexes> *
+                                  tla::size<RowIndexes> *
+                                  tla::size<RowIndexes>) +
+                                 ...)};
+
+  //! The estimate is of a Householder QR decomposition per block and of the
+  //! solutions of its `R1` rows.
+  tla::record<result>(4 * cubes / 3 + 5 * rows * squares,
+                      squares + 2 * rows * (tla::size<RowIndexes> + ...),
+                      sizeof...(Matrices));
+
+  typed_matrix<result, Indexes, tla::concatenate<RowIndexes...>> value{
+      lhs.data};
+
+  rhs.for_each_block([&value, &lhs](const auto &block, std::size_t offset) {
+    constexpr std::size_t size{std::remove_cvref_t<decltype(block)>::rows};
+    using part = tla::resize<result, tla::size<Indexes>, size>;
+
+    tla::place<tla::size<Indexes>, size>(
+        value.data,
+        tla::divide<part>(tla::slice<part, tla::size<Indexes>, size>(
+                              lhs.data, 0, offset),
+                          block.data),
+        0, offset);
+  });
+
+  tla::inspect("division", value);
+
+  return tla::decay(std::move(value));
+}
+
+//! @brief Inverts the typed block diagonal matrix block by block.
+//!
+//! @details The inverse blocks are the inverses of the blocks. The row indexes
+//! of each inverse block are the reciprocals of the column indexes of its
+//! block, and vice versa, for the inverse elements to be of the reciprocal
+//! types.
+template <typename... Matrices, typename... RowIndexes,
+          typename... ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+inverse(const typed_block_diagonal_matrix<
+        typed_matrix<Matrices, RowIndexes, ColumnIndexes>...> &value) {
+  return std::apply(
+      [](const auto &...blocks) {
+        return typed_block_diagonal_matrix{[](const auto &block) {
+          using block_type = std::remove_cvref_t<decltype(block)>;
+          using result = tla::evaluate<decltype(block.data)>;
+          using underlying = tla::underlying_t<result>;
+          constexpr std::uint64_t size{block_type::rows};
+
+          tla::record<result>(4 * size * size * size / 3 +
+                                  5 * size * size * size,
+                              3 * size * size, 1);
+
+          result unit;
+
+          for (std::size_t j{0}; j < size; ++j) {
+            for (std::size_t i{0}; i < size; ++i) {
+              unit(i, j) = i == j ? underlying{1} : underlying{0};
+            }
+          }
+
+          return typed_matrix<
+              result,
+              tla::reciprocal_indexes<typename block_type::column_indexes>,
+              tla::reciprocal_indexes<typename block_type::row_indexes>>{
+              tla::divide<result>(unit, block.data)};
+        }(blocks)...};
+      },
+      value.blocks);
+}
+
+//! @brief Cholesky factorization of the typed block diagonal matrix.
+//!
+//! @details Each block is factored on its own. The factor is the typed block
+//! diagonal matrix of the triangular factors of the blocks.
+//!
+//! @tparam Part The triangle of the resulting factors.
+//!
+//! @return The factor, or no value if a block is not positive definite.
+template <triangle Part = triangle::lower, typename... Matrices,
+          typename... RowIndexes, typename... ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+cholesky(const typed_block_diagonal_matrix<
+         typed_matrix<Matrices, RowIndexes, ColumnIndexes>...> &value) {
+  return std::apply(
+      [](const auto &...blocks) {
+        return [](const auto &...factors)
+                   -> std::optional<typed_block_diagonal_matrix<
+                       typename std::remove_cvref_t<
+                           decltype(factors)>::value_type...>> {
+          if (!(factors && ...)) {
+            return std::nullopt;
+          }
+
+          return typed_block_diagonal_matrix{*factors...};
+        }(cholesky<Part>(blocks)...);
+      },
+      value.blocks);
+}
+
+//! @brief Reconstructs the typed block diagonal matrix of the factors.
+template <typename... Matrices, typename... RowIndexes,
+          typename... ColumnIndexes, triangle Part>
+[[nodiscard]] inline constexpr auto
+reconstruct(const typed_block_diagonal_matrix<typed_triangular_factor<
+                Matrices, RowIndexes, ColumnIndexes, Part>...> &value) {
+  return std::apply(
+      [](const auto &...blocks) {
+        return typed_block_diagonal_matrix{reconstruct(blocks)...};
+      },
+      value.blocks);
+}
+
+//! @brief Solves `L * X = B` by forward substitution, block by block.
+//!
+//! @details Each lower factor solves its own rows of `B`.
+template <typename... Matrices, typename... RowIndexes,
+          typename... ColumnIndexes, triangle Part, typename Matrix,
+          typename Indexes>
+[[nodiscard]] inline constexpr auto
+solve_lower(const typed_block_diagonal_matrix<typed_triangular_factor<
+                Matrices, RowIndexes, ColumnIndexes, Part>...> &factor,
+            const typed_matrix<Matrix, tla::concatenate<RowIndexes...>,
+                               Indexes> &rhs) {
+  using result = tla::evaluate<Matrix>;
+  using underlying = tla::underlying_t<Matrix>;
+  constexpr std::uint64_t columns{tla::size<Indexes>};
+  constexpr std::uint64_t squares{
+      ((tla::size<RowIndexes> * tla::size<RowIndexes>) + ...)};
+
+  tla::record<result>(squares * columns,
+                      squares + 2 * (tla::size<RowIndexes> + ...) * columns);
+
+  typed_matrix<result, tla::concatenate<RowIndexes...>, Indexes> value{
+      rhs.data};
+
+  factor.for_each_block([&value](const auto &block, std::size_t offset) {
+    constexpr std::size_t size{std::remove_cvref_t<decltype(block)>::rows};
+    using part = tla::resize<result, size, tla::size<Indexes>>;
+    part solution{
+        tla::slice<part, size, tla::size<Indexes>>(value.data, offset, 0)};
+
+    tla::solve_lower<underlying, size, tla::size<Indexes>>(
+        block.lower(), tla::accessor<false>(solution));
+    tla::place<size, tla::size<Indexes>>(value.data, solution, offset, 0);
+  });
+
+  return value;
+}
+
+//! @brief Solves `U * X = B` by backward substitution, block by block.
+//!
+//! @details Each upper factor solves its own rows of `B`.
+template <typename... Matrices, typename... RowIndexes,
+          typename... ColumnIndexes, triangle Part, typename Matrix,
+          typename Indexes>
+[[nodiscard]] inline constexpr auto
+solve_upper(const typed_block_diagonal_matrix<typed_triangular_factor<
+                Matrices, RowIndexes, ColumnIndexes, Part>...> &factor,
+            const typed_matrix<Matrix, tla::concatenate<RowIndexes...>,
+                               Indexes> &rhs) {
+  using result = tla::evaluate<Matrix>;
+  using underlying = tla::underlying_t<Matrix>;
+  constexpr std::uint64_t columns{tla::size<Indexes>};
+  constexpr std::uint64_t squares{
+      ((tla::size<RowIndexes> * tla::size<RowIndexes>) + ...)};
+
+  tla::record<result>(squares * columns,
+                      squares + 2 * (tla::size<RowIndexes> + ...) * columns);
+
+  typed_matrix<result, tla::concatenate<RowIndexes...>, Indexes> value{
+      rhs.data};
+
+  factor.for_each_block([&value](const auto &block, std::size_t offset) {
+    constexpr std::size_t size{std::remove_cvref_t<decltype(block)>::rows};
+    using part = tla::resize<result, size, tla::size<Indexes>>;
+    part solution{
+        tla::slice<part, size, tla::size<Indexes>>(value.data, offset, 0)};
+
+    tla::solve_upper<underlying, size, tla::size<Indexes>>(
+        block.upper(), tla::accessor<false>(solution));
+    tla::place<size, tla::size<Indexes>>(value.data, solution, offset, 0);
+  });
+
+  return value;
+}
+
+//! @brief Matrix exponential of the typed matrix.
+//!
+//! @details The exponential of the continuous transition rate `A * dt` is the
+//! discrete transition `F = exp(A * dt)`. The elements of the powers of the
+//! matrix are of the same types as the elements of the matrix, the exponential
+//! keeps its index types. Computed by scaling and squaring of a Pade
+//! approximant.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::same_size<RowIndexes, ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+exp(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  constexpr std::size_t size{tla::size<RowIndexes>};
+  constexpr std::uint64_t cube{size * size * size};
+
+  typed_matrix<tla::evaluate<Matrix>, RowIndexes, ColumnIndexes> result{
+      value.data};
+
+  const std::uint64_t squarings{tla::exponential<underlying, size>(
+      tla::accessor<false>(result.data))};
+
+  //! The estimate is of the five products of the approximant, of its solution,
+  //! and of the squarings.
+  tla::record<tla::evaluate<Matrix>>((38 + 6 * squarings) * cube / 3,
+                                     2 * size * size, 1);
+
+  return result;
+}
+
+//! @brief Van Loan discretization of the continuous-time model.
+//!
+//! @details Computes the discrete transition `F = exp(A * dt)` and process
+//! noise covariance `Q` of the continuous model `x' = A * x + G * w` with the
+//! spectral density `Qc` of the white noise `w` over the time step `dt`. The
+//! exponential of the block matrix `[-A, G * Qc * G^T; 0, A^T] * dt` is the
+//! block matrix `[..., F^-1 * Q; 0, F^T]`. The transition keeps the index types
+//! of `A`, the covariance is indexed by the rows of `A`.
+//!
+//! @return The pair of the transition `F` and of the covariance `Q`.
+template <typename Matrix1, typename Matrix2, typename Matrix3,
+          typename RowIndexes, typename ColumnIndexes, typename InputIndexes,
+          tla::arithmetic Scalar>
+  requires tla::same_size<RowIndexes, ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+discretize(const typed_matrix<Matrix1, RowIndexes, ColumnIndexes> &drift,
+           const typed_matrix<Matrix2, RowIndexes, InputIndexes> &input,
+           const typed_matrix<Matrix3, InputIndexes, InputIndexes> &density,
+           Scalar step) {
+  using underlying = tla::underlying_t<Matrix1>;
+  constexpr std::size_t size{tla::size<RowIndexes>};
+  constexpr std::uint64_t cube{size * size * size};
+
+  const tla::evaluate<Matrix1> noise{input.data * density.data *
+                                     tla::transposes<Matrix2>{}(input.data)};
+  std::array<underlying, 4 * size * size> block{};
+  const auto element{
+      [&block](std::size_t row, std::size_t column) -> underlying & {
+        return block[row * 2 * size + column];
+      }};
+
+  for (std::size_t i{0}; i < size; ++i) {
+    for (std::size_t j{0}; j < size; ++j) {
+      element(i, j) = -drift.data(i, j) * step;
+      element(i, size + j) = noise(i, j) * step;
+      element(size + i, size + j) = drift.data(j, i) * step;
+    }
+  }
+
+  const std::uint64_t squarings{
+      tla::exponential<underlying, 2 * size>(element)};
+
+  //! The estimate is of the exponential of the block matrix and of the product
+  //! of the covariance.
+  tla::record<tla::evaluate<Matrix1>>(
+      (38 + 6 * squarings) * 8 * cube / 3 + 2 * cube, 10 * size * size, 1);
+
+  typed_matrix<tla::evaluate<Matrix1>, RowIndexes, ColumnIndexes> transition;
+  typed_matrix<tla::evaluate<Matrix1>, RowIndexes, RowIndexes> covariance;
+
+  for (std::size_t i{0}; i < size; ++i) {
+    for (std::size_t j{0}; j < size; ++j) {
+      transition.data(i, j) = element(size + j, size + i);
+    }
+  }
+
+  for (std::size_t i{0}; i < size; ++i) {
+    for (std::size_t j{0}; j <= i; ++j) {
+      underlying lower{0};
+      underlying upper{0};
+
+      for (std::size_t k{0}; k < size; ++k) {
+        lower += transition.data(i, k) * element(k, size + j);
+        upper += transition.data(j, k) * element(k, size + i);
+      }
+
+      covariance.data(i, j) = (lower + upper) / underlying{2};
+      covariance.data(j, i) = covariance.data(i, j);
+    }
+  }
+
+  return std::pair{transition, covariance};
+}
+
+//! @brief The sum of the elements of the uniform typed matrix.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::uniform<typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+sum(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  using element = tla::element<typed_matrix<Matrix, RowIndexes, ColumnIndexes>,
+                               0, 0>;
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t columns{tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(rows * columns, rows * columns);
+
+  underlying result{tla::sums<Matrix, rows, columns>{}(value.data)};
+
+  return tla::element_traits<underlying, element>::from_underlying(result);
+}
+
+//! @brief The smallest element of the uniform typed matrix.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::uniform<typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+min(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  using element = tla::element<typed_matrix<Matrix, RowIndexes, ColumnIndexes>,
+                               0, 0>;
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t columns{tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(rows * columns, rows * columns);
+
+  underlying result{tla::minimums<Matrix, rows, columns>{}(value.data)};
+
+  return tla::element_traits<underlying, element>::from_underlying(result);
+}
+
+//! @brief The largest element of the uniform typed matrix.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::uniform<typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+max(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  using element = tla::element<typed_matrix<Matrix, RowIndexes, ColumnIndexes>,
+                               0, 0>;
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t columns{tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(rows * columns, rows * columns);
+
+  underlying result{tla::maximums<Matrix, rows, columns>{}(value.data)};
+
+  return tla::element_traits<underlying, element>::from_underlying(result);
+}
+
+//! @brief The sum of the diagonal elements of the square typed matrix.
+//!
+//! @details The diagonal element types must be the same, as for the trace of a
+//! covariance of a state of a single quantity kind.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::uniform_diagonal<
+      typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+trace(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  using element = tla::element<typed_matrix<Matrix, RowIndexes, ColumnIndexes>,
+                               0, 0>;
+  constexpr std::size_t size{tla::size<RowIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(size, size);
+
+  underlying result{tla::traces<Matrix, size>{}(value.data)};
+
+  return tla::element_traits<underlying, element>::from_underlying(result);
+}
+
+//! @brief The dot product of the typed column vectors.
+//!
+//! @details The products of the element types at each position must be the
+//! same, the result is of that product type.
+template <typename Matrix1, typename Matrix2, typename RowIndexes1,
+          typename RowIndexes2, typename ColumnIndexes1,
+          typename ColumnIndexes2>
+  requires tla::uniform_product<
+      typed_matrix<Matrix1, RowIndexes1, ColumnIndexes1>,
+      typed_matrix<Matrix2, RowIndexes2, ColumnIndexes2>>
+[[nodiscard]] inline constexpr auto
+dot(const typed_matrix<Matrix1, RowIndexes1, ColumnIndexes1> &lhs,
+    const typed_matrix<Matrix2, RowIndexes2, ColumnIndexes2> &rhs) {
+  using underlying = tla::underlying_t<Matrix1>;
+  using element =
+      tla::product<tla::element<typed_matrix<Matrix1, RowIndexes1,
+                                             ColumnIndexes1>,
+                                0, 0>,
+                   tla::element<typed_matrix<Matrix2, RowIndexes2,
+                                             ColumnIndexes2>,
+                                0, 0>>;
+  constexpr std::size_t size{tla::size<RowIndexes1>};
+
+  tla::record<tla::evaluate<Matrix1>>(2 * size, 2 * size);
+
+  underlying result{
+      tla::dots<Matrix1, Matrix2, size>{}(lhs.data, rhs.data)};
+
+  return tla::element_traits<underlying, element>::from_underlying(result);
+}
+
+//! @brief The squared Euclidean norm of the typed column vector.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::uniform_product<
+      typed_matrix<Matrix, RowIndexes, ColumnIndexes>,
+      typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+squared_norm(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  return dot(value, value);
+}
+
+//! @brief The Euclidean norm of the uniform typed column vector.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+  requires tla::uniform<typed_matrix<Matrix, RowIndexes, ColumnIndexes>> &&
+           tla::column<typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+norm(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  using element = tla::element<typed_matrix<Matrix, RowIndexes, ColumnIndexes>,
+                               0, 0>;
+  constexpr std::size_t size{tla::size<RowIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(2 * size + 1, size);
+
+  underlying result{
+      std::sqrt(tla::dots<Matrix, Matrix, size>{}(value.data, value.data))};
+
+  return tla::element_traits<underlying, element>::from_underlying(result);
+}
+
+//! @brief Gates the measurements against the tracks in one pass.
+//!
+//! @details Evaluates the squared Mahalanobis distances `y^T * S^-1 * y` of the
+//! residuals `y = z - h` of every measurement `z` to every track of predicted
+//! measurement `h` and innovation covariance `S`. Each covariance is factored
+//! once. The distances are computed by blocks of measurements, the solutions
+//! vectorized across the measurements of a block. A track whose covariance is
+//! not positive definite gates no measurement. No allocation occurs.
+//!
+//! @param predictions The range of the predicted typed measurements `h` of the
+//! tracks.
+//! @param innovations The range of the typed innovation covariances `S` of the
+//! tracks, square and indexed by the rows of the measurements, of the size of
+//! the predictions.
+//! @param measurements The range of the typed measurements `z`.
+//! @param threshold The gate on the squared distances, inclusive.
+//! @param output The output iterator of the gated track and measurement index
+//! pairs with their squared distance.
+//!
+//! @return The output iterator past the last gated pair.
+template <std::ranges::random_access_range Predictions,
+          std::ranges::random_access_range Innovations,
+          std::ranges::random_access_range Measurements,
+          typename OutputIterator>
+  requires tla::column<std::ranges::range_value_t<Measurements>> &&
+           std::same_as<std::ranges::range_value_t<Predictions>,
+                        std::ranges::range_value_t<Measurements>> &&
+           std::same_as<typename std::ranges::range_value_t<
+                            Innovations>::row_indexes,
+                        typename std::ranges::range_value_t<
+                            Measurements>::row_indexes> &&
+           std::same_as<typename std::ranges::range_value_t<
+                            Innovations>::column_indexes,
+                        typename std::ranges::range_value_t<
+                            Measurements>::row_indexes>
+inline constexpr OutputIterator
+gate(const Predictions &predictions, const Innovations &innovations,
+     const Measurements &measurements,
+     typename std::ranges::range_value_t<Measurements>::underlying threshold,
+     OutputIterator output) {
+  using vector = std::ranges::range_value_t<Measurements>;
+  using underlying = typename vector::underlying;
+  constexpr std::size_t size{vector::rows};
+  constexpr std::size_t block{16};
+  const std::size_t tracks{std::ranges::size(predictions)};
+  const std::size_t count{std::ranges::size(measurements)};
+
+  assert(std::ranges::size(innovations) == tracks &&
+         "The count of innovations must match the count of predictions.");
+
+  tla::record<tla::evaluate<decltype(vector::data)>>(
+      tracks * count * (size * size + 2 * size),
+      tracks * (size * size + size) + count * size);
+
+  for (std::size_t track{0}; track < tracks; ++track) {
+    const auto &prediction{predictions[track]};
+    const auto factor{cholesky(innovations[track])};
+
+    if (!factor) {
+      continue;
+    }
+
+    for (std::size_t first{0}; first < count; first += block) {
+      const std::size_t width{std::min(block, count - first)};
+      std::array<underlying, size * block> residuals{};
+
+      for (std::size_t c{0}; c < width; ++c) {
+        for (std::size_t i{0}; i < size; ++i) {
+          residuals[i * block + c] = measurements[first + c].data(i, 0) -
+                                     prediction.data(i, 0);
+        }
+      }
+
+      const std::array<underlying, block> distances{
+          tla::mahalanobis<underlying, size, block>(factor->lower(),
+                                                    residuals)};
+
+      for (std::size_t c{0}; c < width; ++c) {
+        if (distances[c] <= threshold) {
+          *output++ = std::tuple{track, first + c, distances[c]};
+        }
+      }
+    }
+  }
+
+  return output;
+}
+
+//! @brief Jacobian of the typed model at the typed column vector.
+//!
+//! @details Forward-mode automatic differentiation. The model is evaluated once
+//! on dual numbers seeded with the variables of the column vector, all the
+//! partial derivatives are computed together in the lanes of the dual numbers.
+//! The model must accept typed column vectors of any underlying element type
+//! and return a typed column vector. The rows of the Jacobian are indexed by
+//! the rows of the result of the model, its columns by the rows of the column
+//! vector, by the contraction convention of the typed products: the Jacobian
+//! composes with the column vector and its covariance as `J * x` and
+//! `J * P * transpose(J)`.
+template <typename Function, typename Matrix, typename RowIndexes,
+          typename ColumnIndexes>
+  requires tla::column<typed_matrix<Matrix, RowIndexes, ColumnIndexes>>
+[[nodiscard]] inline constexpr auto
+jacobian(Function &&function,
+         const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  using variable = dual<underlying, tla::size<RowIndexes>>;
+  constexpr std::size_t size{tla::size<RowIndexes>};
+
+  typed_matrix<tla::rebind<tla::evaluate<Matrix>, variable>, RowIndexes,
+               ColumnIndexes>
+      variables;
+
+  for (std::size_t j{0}; j < size; ++j) {
+    variables.data(j, 0) = variable{value.data(j, 0), j};
+  }
+
+  const auto result{std::forward<Function>(function)(variables)};
+  using output = std::remove_cvref_t<decltype(result)>;
+
+  static_assert(tla::typed_matrix<output> && tla::column<output>,
+                "The model must return a typed column vector.");
+
+  using storage = tla::evaluate<tla::product<
+      tla::rebind<decltype(output::data), underlying>, tla::transpose<Matrix>>>;
+  constexpr std::size_t rows{output::rows};
+
+  tla::record<storage>(0, rows * size);
+
+  typed_matrix<storage, typename output::row_indexes, RowIndexes> derivatives;
+
+  for (std::size_t i{0}; i < rows; ++i) {
+    for (std::size_t j{0}; j < size; ++j) {
+      derivatives.data(i, j) = result.data(i, 0).gradient[j];
+    }
+  }
+
+  return derivatives;
+}
+
+//! @brief Sigma points of the typed state of the unscented transform.
+//!
+//! @details The mean is broadcast to the `2 * n + 1` columns of one contiguous
+//! typed matrix, spread by the columns of the lower Cholesky factor of the
+//! covariance. The covariance is square, indexed by the rows of the state. The
+//! rows keep the index types of the state. Propagate the sigma points at once,
+//! for example by a product of the whole matrix.
+//!
+//! @return The sigma points, or no value if the covariance is not positive
+//! definite.
+template <typename Type, std::size_t Size, typename Matrix1, typename Matrix2,
+          typename RowIndexes, typename ColumnIndexes>
+  requires(tla::size<RowIndexes> == Size && tla::size<ColumnIndexes> == 1)
+[[nodiscard]] inline constexpr auto
+sigma_points(const unscented_transform<Type, Size> &transform,
+             const typed_matrix<Matrix1, RowIndexes, ColumnIndexes> &mean,
+             const typed_matrix<Matrix2, RowIndexes, RowIndexes> &covariance) {
+  using underlying = tla::underlying_t<Matrix1>;
+  constexpr std::size_t points{unscented_transform<Type, Size>::points};
+  using storage = tla::resize<tla::evaluate<Matrix1>, Size, points>;
+  using column_index = std::tuple_element_t<0, ColumnIndexes>;
+  using sigmas = typed_matrix<storage, RowIndexes,
+                              tla::tuple_n_type<column_index, points>>;
+
+  tla::record<storage>(2 * Size * Size, Size * points);
+
+  const auto factor{cholesky(covariance)};
+
+  if (!factor) {
+    return std::optional<sigmas>{};
+  }
+
+  const auto lower{factor->lower()};
+  const underlying spread{std::sqrt(Type(Size) + transform.lambda())};
+  sigmas result;
+
+  for (std::size_t i{0}; i < Size; ++i) {
+    result.data(i, 0) = mean.data(i, 0);
+  }
+
+  for (std::size_t j{0}; j < Size; ++j) {
+    for (std::size_t i{0}; i < Size; ++i) {
+      const underlying delta{spread * lower(i, j)};
+
+      result.data(i, 1 + j) = mean.data(i, 0) + delta;
+      result.data(i, 1 + Size + j) = mean.data(i, 0) - delta;
+    }
+  }
+
+  return std::optional<sigmas>{result};
+}
+
+//! @brief Weighted recombination of the typed sigma points.
+//!
+//! @details The weighted mean and covariance of the propagated sigma points of
+//! the unscented transform. The rows of the sigma points may be of another
+//! space than the state, such as a measurement space. The deviations from the
+//! mean are weighted in place and the covariance is one product of the
+//! underlying storages, evaluated by the product kernel.
+//!
+//! @return The pair of the typed mean and covariance.
+template <typename Type, std::size_t Size, typename Matrix,
+          typename RowIndexes, typename ColumnIndexes>
+  requires(tla::size<ColumnIndexes> == unscented_transform<Type, Size>::points)
+[[nodiscard]] inline constexpr auto
+recombine(const unscented_transform<Type, Size> &transform,
+          const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &sigmas) {
+  using underlying = tla::underlying_t<Matrix>;
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t points{unscented_transform<Type, Size>::points};
+  using storage = tla::evaluate<Matrix>;
+  using square = tla::resize<storage, rows, rows>;
+  using column_index = std::tuple_element_t<0, ColumnIndexes>;
+
+  tla::record<storage>(4 * rows * points, 3 * rows * points);
+
+  typed_matrix<tla::resize<storage, rows, 1>, RowIndexes,
+               std::tuple<column_index>>
+      mean;
+  typed_matrix<square, RowIndexes, RowIndexes> covariance;
+  storage deviations;
+  storage weighted;
+
+  for (std::size_t i{0}; i < rows; ++i) {
+    underlying value{0};
+
+    for (std::size_t j{0}; j < points; ++j) {
+      value += transform.mean_weight(j) * sigmas.data(i, j);
+    }
+
+    mean.data(i, 0) = value;
+  }
+
+  for (std::size_t j{0}; j < points; ++j) {
+    const underlying weight{transform.covariance_weight(j)};
+
+    for (std::size_t i{0}; i < rows; ++i) {
+      deviations(i, j) = sigmas.data(i, j) - mean.data(i, 0);
+      weighted(i, j) = weight * deviations(i, j);
+    }
+  }
+
+  tla::record<square>(2 * rows * rows * points,
+                      2 * rows * points + rows * rows);
+
+  covariance.data = tla::multiply<square>(
+      weighted, tla::transposes<storage>{}(deviations));
+
+  return std::pair{mean, covariance};
+}
+
+//! @brief Lazy concatenation of the typed matrices in the direction.
+//!
+//! @details Assign the expression to a preallocated destination, or convert it
+//! to its dense typed matrix.
+template <stacking Direction, typename... Pieces>
+  requires(tla::typed_matrix<Pieces> && ...)
+[[nodiscard]] inline constexpr auto stack(const Pieces &...pieces) {
+  return typed_stack<Direction, Pieces...>{{pieces...}};
+}
+
+//! @brief Horizontal concatenation of the typed matrices.
+//!
+//! @details The typed matrices share their row indexes, their column indexes
+//! are concatenated.
+template <typename... Pieces>
+  requires(tla::typed_matrix<Pieces> && ...)
+[[nodiscard]] inline constexpr auto hstack(const Pieces &...pieces) {
+  using expression = typed_stack<stacking::horizontal, Pieces...>;
+  typename expression::type result;
+
+  expression{{pieces...}}.assign_to(result);
+
+  return result;
+}
+
+//! @brief Vertical concatenation of the typed matrices.
+//!
+//! @details The typed matrices share their column indexes, their row indexes
+//! are concatenated.
+template <typename... Pieces>
+  requires(tla::typed_matrix<Pieces> && ...)
+[[nodiscard]] inline constexpr auto vstack(const Pieces &...pieces) {
+  using expression = typed_stack<stacking::vertical, Pieces...>;
+  typename expression::type result;
+
+  expression{{pieces...}}.assign_to(result);
+
+  return result;
+}
+
+//! @brief Kronecker product of the typed matrices.
+//!
+//! @details The element at row `i * p + k` and column `j * q + l` is the
+//! product of the element `(i, j)` of the left hand side and of the element
+//! `(k, l)` of the `p x q` right hand side. The indexes of the product are the
+//! pairwise products of the indexes of the operands.
+template <typename Lhs, typename Rhs>
+  requires tla::typed_matrix<Lhs> && tla::typed_matrix<Rhs>
+[[nodiscard]] inline constexpr auto kronecker(const Lhs &lhs, const Rhs &rhs) {
+  using expression = typed_kronecker<Lhs, Rhs>;
+  constexpr std::uint64_t size{expression::rows * expression::columns};
+
+  tla::record<decltype(expression::type::data)>(
+      size, Lhs::rows * Lhs::columns + Rhs::rows * Rhs::columns + size);
+
+  typename expression::type result;
+
+  expression{lhs, rhs}.assign_to(result);
+
+  return result;
+}
+
+//! @brief Lazy Kronecker product of the typed matrices.
+//!
+//! @details Multiply the expression by typed matrices without materializing
+//! the product, or convert it to its dense typed matrix.
+template <typename Lhs, typename Rhs>
+  requires tla::typed_matrix<Lhs> && tla::typed_matrix<Rhs>
+[[nodiscard]] inline constexpr auto lazy_kronecker(const Lhs &lhs,
+                                                   const Rhs &rhs) {
+  return typed_kronecker<Lhs, Rhs>{lhs, rhs};
+}
+
+//! @brief Product of a lazy Kronecker product by a typed matrix.
+//!
+//! @details Each column `vec(X)` of the `nq x c` typed matrix is multiplied as
+//! `kron(A, B) * vec(X) = vec(B * X * A^T)` for the `m x n` matrix `A` and the
+//! `p x q` matrix `B`. The cost is `O(pn(q + m) c)` operations instead of the
+//! `O(mnpq c)` operations of the dense product, and the `mp x nq` Kronecker
+//! product is never formed.
+template <typename Matrix1, typename RowIndexes1, typename ColumnIndexes1,
+          typename Matrix2, typename RowIndexes2, typename ColumnIndexes2,
+          typename Matrix, typename Indexes>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_kronecker<
+              typed_matrix<Matrix1, RowIndexes1, ColumnIndexes1>,
+              typed_matrix<Matrix2, RowIndexes2, ColumnIndexes2>> &lhs,
+          const typed_matrix<
+              Matrix, tla::kronecker_indexes<ColumnIndexes1, ColumnIndexes2>,
+              Indexes> &rhs) {
+  constexpr std::size_t m{tla::size<RowIndexes1>};
+  constexpr std::size_t n{tla::size<ColumnIndexes1>};
+  constexpr std::size_t p{tla::size<RowIndexes2>};
+  constexpr std::size_t q{tla::size<ColumnIndexes2>};
+  constexpr std::size_t columns{tla::size<Indexes>};
+  using result = tla::resize<tla::evaluate<Matrix>, m * p, columns>;
+  using unvectorized = tla::resize<tla::evaluate<Matrix2>, q, n>;
+  using partial = tla::resize<tla::evaluate<Matrix2>, p, n>;
+  using folded = tla::resize<tla::evaluate<Matrix2>, p, m>;
+
+  tla::record<result>(2 * (p * q * n + p * n * m) * columns,
+                      m * n + p * q + (n * q + m * p) * columns);
+
+  typed_matrix<result, tla::kronecker_indexes<RowIndexes1, RowIndexes2>,
+               Indexes>
+      value;
+
+  for (std::size_t c{0}; c < columns; ++c) {
+    unvectorized x;
+
+    for (std::size_t j{0}; j < n; ++j) {
+      for (std::size_t l{0}; l < q; ++l) {
+        x(l, j) = rhs.data(j * q + l, c);
+      }
+    }
+
+    const folded y{tla::multiply<folded>(
+        tla::multiply<partial>(lhs.rhs.data, x),
+        tla::transposes<decltype(lhs.lhs.data)>{}(lhs.lhs.data))};
+
+    for (std::size_t i{0}; i < m; ++i) {
+      for (std::size_t k{0}; k < p; ++k) {
+        value.data(i * p + k, c) = y(k, i);
+      }
+    }
+  }
+
+  tla::inspect("product", value);
+
+  return tla::decay(std::move(value));
+}
+
+//! @brief Stacks the columns of the typed matrix into a typed column vector.
+//!
+//! @details The element at row `j * R + i` of the vectorization is the element
+//! `(i, j)` of the `R x C` typed matrix, of the same type.
+template <typename Matrix, typename RowIndexes, typename ColumnIndexes>
+[[nodiscard]] inline constexpr auto
+vec(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t columns{tla::size<ColumnIndexes>};
+
+  tla::record<tla::evaluate<Matrix>>(0, 2 * rows * columns);
+
+  typed_matrix<tla::resize<tla::evaluate<Matrix>, rows * columns, 1>,
+               tla::vectorized_indexes<RowIndexes, ColumnIndexes>,
+               tla::identity_index>
+      result;
+
+  for (std::size_t j{0}; j < columns; ++j) {
+    for (std::size_t i{0}; i < rows; ++i) {
+      result.data(j * rows + i, 0) = value.data(i, j);
+    }
+  }
+
+  return result;
+}
+
+//! @brief Visits each typed element of the typed matrix in the given order.
+//!
+//! @details The traversal is unrolled at compile time. The visitor receives
+//! each element with its own type, along with its row and column positions as
+//! integral constants when it accepts them. Mixed-unit matrices are traversed
+//! without runtime dispatch. The elements are mutable through a mutable typed
+//! matrix.
+//!
+//! @tparam Order The traversal order of the elements.
+template <storage_order Order = storage_order::row_major, typename TypedMatrix,
+          typename Visitor>
+  requires tla::typed_matrix<std::remove_cvref_t<TypedMatrix>>
+inline constexpr void for_each_element(TypedMatrix &&value,
+                                       Visitor &&visitor) {
+  using matrix = std::remove_cvref_t<TypedMatrix>;
+
+  auto visit{[&value, &visitor](auto i, auto j) {
+    if constexpr (std::invocable<Visitor &, decltype(value.template at<i, j>()),
+                                 decltype(i), decltype(j)>) {
+      visitor(value.template at<i, j>(), i, j);
+    } else {
+      visitor(value.template at<i, j>());
+    }
+  }};
+
+  if constexpr (Order == storage_order::row_major) {
+    tla::for_constexpr<0, matrix::rows, 1>([&visit](auto i) {
+      tla::for_constexpr<0, matrix::columns, 1>(
+          [&visit, &i](auto j) { visit(i, j); });
+    });
+  } else {
+    tla::for_constexpr<0, matrix::columns, 1>([&visit](auto j) {
+      tla::for_constexpr<0, matrix::rows, 1>(
+          [&visit, &j](auto i) { visit(i, j); });
+    });
+  }
+}
+
+//! @brief Converts the typed matrix into the compatible scales of the indexes.
+//!
+//! @details The row and column scale factors are compile-time constants folded
+//! into a single factor per element, applied in one pass. The conversion
+//! between the same scales is a copy.
+//!
+//! @tparam To The typed matrix of the converted indexes.
+template <typename To, typename Matrix, typename RowIndexes,
+          typename ColumnIndexes>
+  requires tla::scalable_indexes<RowIndexes, typename To::row_indexes> &&
+           tla::scalable_indexes<ColumnIndexes, typename To::column_indexes>
+[[nodiscard]] inline constexpr To
+convert(const typed_matrix<Matrix, RowIndexes, ColumnIndexes> &value) {
+  using underlying = tla::underlying_t<Matrix>;
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t columns{tla::size<ColumnIndexes>};
+  constexpr auto factors{[] {
+    constexpr auto row_factors{
+        tla::scale_factors<RowIndexes, typename To::row_indexes>};
+    constexpr auto column_factors{
+        tla::scale_factors<ColumnIndexes, typename To::column_indexes>};
+    std::array<std::array<underlying, columns>, rows> result{};
+
+    for (std::size_t i{0}; i < rows; ++i) {
+      for (std::size_t j{0}; j < columns; ++j) {
+        result[i][j] =
+            static_cast<underlying>(row_factors[i] * column_factors[j]);
+      }
+    }
+
+    return result;
+  }()};
+  constexpr bool unit{[](const auto &values) {
+    for (const auto &row : values) {
+      for (const auto &factor : row) {
+        if (factor != underlying{1}) {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }(factors)};
+
+  if constexpr (unit) {
+    return To{value.data};
+  } else {
+    tla::record<tla::evaluate<Matrix>>(rows * columns, 2 * rows * columns);
+
+    To result;
+
+    for (std::size_t j{0}; j < columns; ++j) {
+      for (std::size_t i{0}; i < rows; ++i) {
+        result.data(i, j) = value.data(i, j) * factors[i][j];
+      }
+    }
+
+    return result;
+  }
+}
+
+//! @brief Product of typed matrices of compatible inner index scales.
+//!
+//! @details The columns of the left-hand side and the rows of the right-hand
+//! side are different but compatible scales of the same indexes. The scale
+//! factors of the rows of the right-hand side into the columns of the
+//! left-hand side are a compile-time diagonal scaling, folded into the smaller
+//! operand before the product. Unit factors cost nothing.
+template <typename Matrix1, typename Matrix2, typename RowIndexes,
+          typename ColumnIndexes, typename Indexes1, typename Indexes2>
+  requires(!std::is_same_v<Indexes1, Indexes2>) &&
+          tla::scalable_indexes<Indexes2, Indexes1>
+[[nodiscard]] inline constexpr auto
+operator*(const typed_matrix<Matrix1, RowIndexes, Indexes1> &lhs,
+          const typed_matrix<Matrix2, Indexes2, ColumnIndexes> &rhs) {
+  using underlying = tla::underlying_t<Matrix1>;
+  using result = tla::evaluate<tla::product<Matrix1, Matrix2>>;
+  constexpr std::size_t rows{tla::size<RowIndexes>};
+  constexpr std::size_t inner{tla::size<Indexes1>};
+  constexpr std::size_t columns{tla::size<ColumnIndexes>};
+  constexpr auto factor{[](std::size_t index) {
+    return static_cast<underlying>(
+        tla::scale_factors<Indexes2, Indexes1>[index]);
+  }};
+  constexpr bool unit{[](auto scale) {
+    for (std::size_t k{0}; k < inner; ++k) {
+      if (scale(k) != underlying{1}) {
+        return false;
+      }
+    }
+
+    return true;
+  }(factor)};
+
+  if constexpr (unit) {
+    tla::record<result>(2 * rows * inner * columns,
+                        rows * inner + inner * columns + rows * columns);
+
+    return tla::decay(typed_matrix<result, RowIndexes, ColumnIndexes>{
+        tla::multiply<result>(lhs.data, rhs.data)});
+  } else if constexpr (rows <= columns) {
+    tla::record<result>(rows * inner + 2 * rows * inner * columns,
+                        2 * rows * inner + inner * columns + rows * columns);
+
+    return tla::decay(typed_matrix<result, RowIndexes, ColumnIndexes>{
+        tla::multiply<result>(
+            tla::scale_columns<tla::evaluate<Matrix1>, rows, inner>(lhs.data,
+                                                                    factor),
+            rhs.data)});
+  } else {
+    tla::record<result>(inner * columns + 2 * rows * inner * columns,
+                        rows * inner + 2 * inner * columns + rows * columns);
+
+    return tla::decay(typed_matrix<result, RowIndexes, ColumnIndexes>{
+        tla::multiply<result>(
+            lhs.data, tla::scale_rows<tla::evaluate<Matrix2>, inner, columns>(
+                          factor, rhs.data))});
+  }
+}
 } // namespace fcarouge
 
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_TPP
@@ -32,9 +32,11 @@ For more information, please refer to <https://unlicense.org> */
 #ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_UTILITY_HPP
 #define FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_UTILITY_HPP
 
+#include <array>
 #include <concepts>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace fcarouge::typed_linear_algebra_internal {
 
@@ -58,6 +60,19 @@ template <typename Lhs, typename Rhs>
 using quotient =
     std::invoke_result_t<divides<Lhs, Rhs>, const Lhs &, const Rhs &>;
 
+//! @brief Type reciprocal expression type specialization point.
+//!
+//! @details The multiplicative inverse of a type, such as the reciprocal unit
+//! of a quantity.
+template <typename Type> struct reciprocates {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const
+      -> decltype(1 / value);
+};
+
+//! @brief Helper type to deduce the reciprocal of a type.
+template <typename Type>
+using reciprocal = std::invoke_result_t<reciprocates<Type>, const Type &>;
+
 //! @brief Type multiplies expression type specialization point.
 template <typename Lhs, typename Rhs> struct multiplies {
   [[nodiscard]] inline constexpr auto
@@ -78,6 +93,37 @@ template <typename Type> struct evaluates {
 //! @brief Evaluater helper type.
 template <typename Type> using evaluate = std::invoke_result_t<evaluates<Type>>;
 
+//! @brief Storage element type rebinding specialization point.
+//!
+//! @details The storage of the same sizes with elements of the given type.
+template <typename Matrix, typename Type> struct rebinds {
+  [[nodiscard]] inline constexpr auto operator()() const -> Matrix;
+};
+
+//! @brief Rebinder helper type.
+template <typename Matrix, typename Type>
+using rebind = std::invoke_result_t<rebinds<Matrix, Type>>;
+
+//! @brief Storage resizing specialization point.
+//!
+//! @details The storage of the same element type with the given sizes.
+template <typename Matrix, std::size_t Rows, std::size_t Columns>
+struct resizes {
+  [[nodiscard]] inline constexpr auto operator()() const -> Matrix;
+};
+
+//! @brief Resizer helper type.
+template <typename Matrix, std::size_t Rows, std::size_t Columns>
+using resize = std::invoke_result_t<resizes<Matrix, Rows, Columns>>;
+
+//! @brief Storage allocation specialization point.
+//!
+//! @details Whether the evaluation of the storage allocates dynamic memory.
+//! Compile-time sized storages do not allocate.
+template <typename Type> struct allocates {
+  [[nodiscard]] inline constexpr bool operator()() const { return false; }
+};
+
 //! @name Functions
 //! @{
 
@@ -96,6 +142,198 @@ inline constexpr void for_constexpr(Function &&function) {
 
 //! @}
 
+//! @brief Out-of-line evaluation kernels of the storage operations.
+//!
+//! @details The evaluation kernels are the instantiation points of the storage
+//! operations with explicit result types. The index types are checked by the
+//! typed operators and never reach the kernels: all the typings of the same
+//! storages share one kernel instantiation. Their common instantiations may be
+//! compiled once in a companion library and declared `extern template`. The
+//! kernels are neither inline nor constexpr for the declarations to suppress
+//! their implicit instantiation at every optimization level.
+namespace kernel {
+
+//! @name Functions
+//! @{
+
+//! @brief Evaluates the product of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] Result multiply(const Lhs &lhs, const Rhs &rhs) {
+  return lhs * rhs;
+}
+
+//! @brief Evaluates the sum of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] Result add(const Lhs &lhs, const Rhs &rhs) {
+  return lhs + rhs;
+}
+
+//! @brief Evaluates the difference of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] Result subtract(const Lhs &lhs, const Rhs &rhs) {
+  return lhs - rhs;
+}
+
+//! @brief Evaluates the solution of the division of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] Result divide(const Lhs &lhs, const Rhs &rhs) {
+  return lhs / rhs;
+}
+
+//! @brief Evaluates the scaling of the rows of the storage by the vector.
+template <typename Result, std::size_t Rows, std::size_t Columns,
+          typename Vector, typename Matrix>
+[[nodiscard]] Result scale_rows(const Vector &lhs, const Matrix &rhs) {
+  Result result{rhs};
+
+  for (std::size_t j{0}; j < Columns; ++j) {
+    for (std::size_t i{0}; i < Rows; ++i) {
+      result(i, j) *= lhs(i);
+    }
+  }
+
+  return result;
+}
+
+//! @brief Evaluates the scaling of the columns of the storage by the vector.
+template <typename Result, std::size_t Rows, std::size_t Columns,
+          typename Matrix, typename Vector>
+[[nodiscard]] Result scale_columns(const Matrix &lhs, const Vector &rhs) {
+  Result result{lhs};
+
+  for (std::size_t j{0}; j < Columns; ++j) {
+    for (std::size_t i{0}; i < Rows; ++i) {
+      result(i, j) *= rhs(j);
+    }
+  }
+
+  return result;
+}
+
+//! @}
+
+} // namespace kernel
+
+//! @name Functions
+//! @{
+
+//! @brief Evaluates the product of the storages.
+//!
+//! @details Constant evaluations compute in place, other evaluations call the
+//! out-of-line kernel.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] inline constexpr Result multiply(const Lhs &lhs,
+                                               const Rhs &rhs) {
+  if consteval {
+    return lhs * rhs;
+  } else {
+    return kernel::multiply<Result>(lhs, rhs);
+  }
+}
+
+//! @brief Evaluates the sum of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] inline constexpr Result add(const Lhs &lhs, const Rhs &rhs) {
+  if consteval {
+    return lhs + rhs;
+  } else {
+    return kernel::add<Result>(lhs, rhs);
+  }
+}
+
+//! @brief Evaluates the difference of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] inline constexpr Result subtract(const Lhs &lhs,
+                                               const Rhs &rhs) {
+  if consteval {
+    return lhs - rhs;
+  } else {
+    return kernel::subtract<Result>(lhs, rhs);
+  }
+}
+
+//! @brief Evaluates the solution of the division of the storages.
+template <typename Result, typename Lhs, typename Rhs>
+[[nodiscard]] inline constexpr Result divide(const Lhs &lhs, const Rhs &rhs) {
+  if consteval {
+    return lhs / rhs;
+  } else {
+    return kernel::divide<Result>(lhs, rhs);
+  }
+}
+
+//! @brief Evaluates the scaling of the rows of the storage by the vector.
+template <typename Result, std::size_t Rows, std::size_t Columns,
+          typename Vector, typename Matrix>
+[[nodiscard]] inline constexpr Result scale_rows(const Vector &lhs,
+                                                 const Matrix &rhs) {
+  if consteval {
+    Result result{rhs};
+
+    for (std::size_t j{0}; j < Columns; ++j) {
+      for (std::size_t i{0}; i < Rows; ++i) {
+        result(i, j) *= lhs(i);
+      }
+    }
+
+    return result;
+  } else {
+    return kernel::scale_rows<Result, Rows, Columns>(lhs, rhs);
+  }
+}
+
+//! @brief Evaluates the scaling of the columns of the storage by the vector.
+template <typename Result, std::size_t Rows, std::size_t Columns,
+          typename Matrix, typename Vector>
+[[nodiscard]] inline constexpr Result scale_columns(const Matrix &lhs,
+                                                    const Vector &rhs) {
+  if consteval {
+    Result result{lhs};
+
+    for (std::size_t j{0}; j < Columns; ++j) {
+      for (std::size_t i{0}; i < Rows; ++i) {
+        result(i, j) *= rhs(j);
+      }
+    }
+
+    return result;
+  } else {
+    return kernel::scale_columns<Result, Rows, Columns>(lhs, rhs);
+  }
+}
+
+//! @brief Copies the `Rows x Columns` block of the storage at the position of
+//! its first row and column.
+template <typename Result, std::size_t Rows, std::size_t Columns,
+          typename Matrix>
+[[nodiscard]] inline constexpr Result
+slice(const Matrix &value, std::size_t row, std::size_t column) {
+  Result result;
+
+  for (std::size_t j{0}; j < Columns; ++j) {
+    for (std::size_t i{0}; i < Rows; ++i) {
+      result(i, j) = value(row + i, column + j);
+    }
+  }
+
+  return result;
+}
+
+//! @brief Writes the `Rows x Columns` storage into the block of the destination
+//! at the position of its first row and column.
+template <std::size_t Rows, std::size_t Columns, typename Matrix,
+          typename Block>
+inline constexpr void place(Matrix &destination, const Block &value,
+                            std::size_t row, std::size_t column) {
+  for (std::size_t j{0}; j < Columns; ++j) {
+    for (std::size_t i{0}; i < Rows; ++i) {
+      destination(row + i, column + j) = value(i, j);
+    }
+  }
+}
+
+//! @}
+
 template <typename Type> struct repacker {
   using type = Type;
 };
@@ -109,12 +347,59 @@ struct repacker<Pack<Types...>> {
 
 template <typename Pack> using repack = repacker<Pack>::type;
 
+//! @brief The concatenation of the types of the packs in a tuple.
+template <typename... Packs>
+using concatenate =
+    decltype(std::tuple_cat(std::declval<repack<Packs>>()...));
+
 //! @brief Size of tuple-like types.
 //!
 //! @details Convenient short form. In place of `std::tuple_size_v`.
 template <typename Pack>
 inline constexpr std::size_t size{repacker<Pack>::size};
 
+template <typename Lhs, typename Rhs,
+          typename = std::make_index_sequence<size<Lhs> * size<Rhs>>>
+struct kronecker_indexer;
+
+template <typename Lhs, typename Rhs, std::size_t... Indexes>
+struct kronecker_indexer<Lhs, Rhs, std::index_sequence<Indexes...>> {
+  using type = std::tuple<
+      product<std::tuple_element_t<Indexes / size<Rhs>, repack<Lhs>>,
+              std::tuple_element_t<Indexes % size<Rhs>, repack<Rhs>>>...>;
+};
+
+//! @brief The pairwise products of the packed index types, in the order of the
+//! Kronecker product.
+//!
+//! @details The index at position `i * size<Rhs> + k` is the product of the
+//! index `i` of the left hand side and of the index `k` of the right hand side.
+template <typename Lhs, typename Rhs>
+using kronecker_indexes = typename kronecker_indexer<Lhs, Rhs>::type;
+
+template <typename RowIndexes, typename ColumnIndexes,
+          typename = std::make_index_sequence<size<RowIndexes> *
+                                              size<ColumnIndexes>>>
+struct vectorized_indexer;
+
+template <typename RowIndexes, typename ColumnIndexes, std::size_t... Indexes>
+struct vectorized_indexer<RowIndexes, ColumnIndexes,
+                          std::index_sequence<Indexes...>> {
+  using type = std::tuple<product<
+      std::tuple_element_t<Indexes % size<RowIndexes>, repack<RowIndexes>>,
+      std::tuple_element_t<Indexes / size<RowIndexes>,
+                           repack<ColumnIndexes>>>...>;
+};
+
+//! @brief The element types of a matrix of the packed index types, stacked
+//! column by column.
+//!
+//! @details The index at position `j * size<RowIndexes> + i` is the type of the
+//! element at row `i` and column `j`.
+template <typename RowIndexes, typename ColumnIndexes>
+using vectorized_indexes =
+    typename vectorized_indexer<RowIndexes, ColumnIndexes>::type;
+
 //! @brief Arithmetic concept.
 //!
 //! @details Any integer or floating point type.
@@ -167,6 +452,42 @@ concept uniform = []() {
   return result;
 }();
 
+//! @brief Every diagonal element types of the square matrix are the same.
+//!
+//! @details The trace of matrices with a uniform diagonal is type safe.
+template <typename Matrix>
+concept uniform_diagonal = []() {
+  bool result{Matrix::rows == Matrix::columns};
+
+  if constexpr (Matrix::rows == Matrix::columns) {
+    for_constexpr<0, Matrix::rows, 1>([&result](auto i) {
+      result &= std::is_same_v<element<Matrix, i, i>, element<Matrix, 0, 0>>;
+    });
+  }
+
+  return result;
+}();
+
+//! @brief Every product of the element types of the column vectors at the same
+//! position are the same.
+//!
+//! @details The dot product of such vectors is type safe.
+template <typename Lhs, typename Rhs>
+concept uniform_product = []() {
+  bool result{Lhs::columns == 1 && Rhs::columns == 1 && Lhs::rows == Rhs::rows};
+
+  if constexpr (Lhs::columns == 1 && Rhs::columns == 1 &&
+                Lhs::rows == Rhs::rows) {
+    for_constexpr<0, Lhs::rows, 1>([&result](auto i) {
+      result &=
+          std::is_same_v<product<element<Lhs, i, 0>, element<Rhs, i, 0>>,
+                         product<element<Lhs, 0, 0>, element<Rhs, 0, 0>>>;
+    });
+  }
+
+  return result;
+}();
+
 //! @brief The index is within the range, inclusive.
 template <std::size_t Index, std::size_t Begin, std::size_t End>
 concept in_range = Begin <= Index && Index <= End;
@@ -191,6 +512,47 @@ concept singleton = column<Matrix> && row<Matrix>;
 template <typename Pack1, typename Pack2>
 concept same_size = size<Pack1> == size<Pack2>;
 
+//! @brief Index type scale conversion specialization point.
+//!
+//! @details The constant factor multiplying a value of the `From` index type to
+//! express it in the `To` index type. The same types convert with a unit
+//! factor. Specialize for the compatible types of different scales, for example
+//! kilometers into meters or degrees into radians.
+template <typename From, typename To> struct scales {
+  [[nodiscard]] inline constexpr double operator()() const
+    requires std::same_as<From, To>
+  {
+    return 1.0;
+  }
+};
+
+//! @brief Helper constant of the index type scale conversion factor.
+template <typename From, typename To>
+inline constexpr double scale{scales<From, To>{}()};
+
+//! @brief The index types convert with a constant scale factor.
+template <typename From, typename To>
+concept scalable = requires { scales<From, To>{}(); };
+
+//! @brief The packed index types convert position by position.
+template <typename From, typename To>
+concept scalable_indexes =
+    same_size<From, To> && []<std::size_t... Indexes>(
+                               std::index_sequence<Indexes...>) {
+      return (scalable<std::tuple_element_t<Indexes, repack<From>>,
+                       std::tuple_element_t<Indexes, repack<To>>> &&
+              ...);
+    }(std::make_index_sequence<size<From>>{});
+
+//! @brief The scale conversion factors of the packed index types.
+template <typename From, typename To>
+inline constexpr std::array<double, size<From>> scale_factors{
+    []<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+      return std::array<double, size<From>>{
+          scale<std::tuple_element_t<Indexes, repack<From>>,
+                std::tuple_element_t<Indexes, repack<To>>>...};
+    }(std::make_index_sequence<size<From>>{})};
+
 //! @brief Element traits for conversions.
 template <typename Underlying, typename Type> struct element_traits {
   [[nodiscard]] static inline constexpr Underlying to_underlying(Type value) {
@@ -201,6 +563,95 @@ template <typename Underlying, typename Type> struct element_traits {
   from_underlying(Underlying &value) {
     return value;
   }
+
+  [[nodiscard]] static inline constexpr const Type &
+  from_underlying(const Underlying &value) {
+    return value;
+  }
+};
+
+//! @brief Linear algebra sum reduction specialization point.
+//!
+//! @details The sum of the elements of the `Rows x Columns` matrix.
+template <typename Type, std::size_t Rows, std::size_t Columns> struct sums {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    underlying_t<Type> result{0};
+
+    for (std::size_t i{0}; i < Rows; ++i) {
+      for (std::size_t j{0}; j < Columns; ++j) {
+        result += value(i, j);
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Linear algebra minimum reduction specialization point.
+//!
+//! @details The smallest element of the `Rows x Columns` matrix.
+template <typename Type, std::size_t Rows, std::size_t Columns>
+struct minimums {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    underlying_t<Type> result{value(0, 0)};
+
+    for (std::size_t i{0}; i < Rows; ++i) {
+      for (std::size_t j{0}; j < Columns; ++j) {
+        result = value(i, j) < result ? value(i, j) : result;
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Linear algebra maximum reduction specialization point.
+//!
+//! @details The largest element of the `Rows x Columns` matrix.
+template <typename Type, std::size_t Rows, std::size_t Columns>
+struct maximums {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    underlying_t<Type> result{value(0, 0)};
+
+    for (std::size_t i{0}; i < Rows; ++i) {
+      for (std::size_t j{0}; j < Columns; ++j) {
+        result = result < value(i, j) ? value(i, j) : result;
+      }
+    }
+
+    return result;
+  }
+};
+
+//! @brief Linear algebra trace reduction specialization point.
+//!
+//! @details The sum of the diagonal elements of the `Size x Size` matrix.
+template <typename Type, std::size_t Size> struct traces {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    underlying_t<Type> result{0};
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      result += value(i, i);
+    }
+
+    return result;
+  }
+};
+
+//! @brief Linear algebra dot product reduction specialization point.
+//!
+//! @details The inner product of the two `Size x 1` column vectors.
+template <typename Lhs, typename Rhs, std::size_t Size> struct dots {
+  [[nodiscard]] inline constexpr auto operator()(const Lhs &lhs,
+                                                 const Rhs &rhs) const {
+    underlying_t<Lhs> result{0};
+
+    for (std::size_t i{0}; i < Size; ++i) {
+      result += lhs(i, 0) * rhs(i, 0);
+    }
+
+    return result;
+  }
 };
 
 //! @brief Linear algebra transposes specialization point.
@@ -224,6 +675,20 @@ struct transposes<Type> {
 template <typename Type>
 using transpose = std::invoke_result_t<transposes<Type>, const Type &>;
 
+//! @brief Decay a singleton typed matrix to its element type.
+//!
+//! @details Other typed matrices are forwarded as-is.
+template <typename TypedMatrix>
+[[nodiscard]] inline constexpr auto decay(TypedMatrix value) {
+  if constexpr (singleton<TypedMatrix>) {
+    return element_traits<typename TypedMatrix::underlying,
+                          element<TypedMatrix, 0, 0>>::
+        from_underlying(value.data(0, 0));
+  } else {
+    return value;
+  }
+}
+
 template <typename Type, std::size_t Size> struct tupler {
   template <typename = std::make_index_sequence<Size>> struct helper;
 
@@ -254,6 +719,21 @@ template <typename Type> struct multiplies<std::type_identity<void>, Type> {
                                                  const Type &rhs) const -> Type;
 };
 
+template <> struct reciprocates<std::type_identity<void>> {
+  [[nodiscard]] inline constexpr auto
+  operator()(std::type_identity<void> value) const -> std::type_identity<void>;
+};
+
+template <typename Pack> struct reciprocal_indexer;
+
+template <typename... Types> struct reciprocal_indexer<std::tuple<Types...>> {
+  using type = std::tuple<reciprocal<Types>...>;
+};
+
+//! @brief The reciprocal types of the packed index types.
+template <typename Pack>
+using reciprocal_indexes = typename reciprocal_indexer<Pack>::type;
+
 } // namespace fcarouge::typed_linear_algebra_internal
 
 #endif // FCAROUGE_TYPED_LINEAR_ALGEBRA_INTERNAL_UTILITY_HPP
@@ -41,8 +41,8 @@ For more information, please refer to <https://unlicense.org> */
 
 #include "fcarouge/typed_linear_algebra.hpp"
 
+#include <cstddef>
 #include <format>
-#include <sstream>
 
 #include <Eigen/Eigen>
 
@@ -56,18 +56,37 @@ concept is_eigen = requires { typename Type::PlainMatrix; };
 
 //! @}
 
+//! @name Variables
+//! @{
+
+//! @brief The Eigen3 options of the storage order of the matrix.
+//!
+//! @details Eigen3 row vectors are row-major, column vectors are column-major.
+template <auto Row, auto Column, storage_order Order>
+inline constexpr int options{
+    Eigen::AutoAlign |
+    (Row == 1 && Column != 1   ? Eigen::RowMajor
+     : Column == 1 && Row != 1 ? Eigen::ColMajor
+     : Order == storage_order::row_major ? Eigen::RowMajor
+                                         : Eigen::ColMajor)};
+
+//! @}
+
 //! @name Types
 //! @{
 
 //! @brief Compile-time sized Eigen3 matrix.
 //!
-//! @details Facade for Eigen3 implementation compatibility.
+//! @details Facade for Eigen3 implementation compatibility. Vectors are stored
+//! in their only possible order regardless of the requested storage order.
 //!
 //! @tparam Type The matrix element type.
 //! @tparam Row The number of rows of the matrix.
 //! @tparam Column The number of columns of the matrix.
-template <typename Type = double, auto Row = 1, auto Column = 1>
-using matrix = Eigen::Matrix<Type, Row, Column>;
+//! @tparam Order The storage order of the elements of the matrix.
+template <typename Type = double, auto Row = 1, auto Column = 1,
+          storage_order Order = storage_order::column_major>
+using matrix = Eigen::Matrix<Type, Row, Column, options<Row, Column, Order>>;
 
 //! @brief Compile-time sized Eigen3 row vector.
 template <typename Type = double, auto Column = 1>
@@ -79,6 +98,21 @@ using column_vector = Eigen::Vector<Type, Row>;
 
 //! @}
 
+//! @name Functions
+//! @{
+
+//! @brief The identity of the Eigen3 matrix.
+template <is_eigen Matrix> [[nodiscard]] inline auto identity() {
+  return Matrix::Identity();
+}
+
+//! @brief The zero of the Eigen3 matrix.
+template <is_eigen Matrix> [[nodiscard]] inline auto zero() {
+  return Matrix::Zero();
+}
+
+//! @}
+
 } // namespace fcarouge::eigen
 
 namespace fcarouge {
@@ -88,9 +122,162 @@ struct typed_linear_algebra_internal::evaluates<Type> {
   [[nodiscard]] inline constexpr auto operator()() const ->
       typename Type::PlainMatrix;
 };
+
+//! @brief Specialization of the rebinding of the element type of the storage.
+template <eigen::is_eigen Matrix, typename Type>
+struct typed_linear_algebra_internal::rebinds<Matrix, Type> {
+  [[nodiscard]] inline constexpr auto operator()() const
+      -> Eigen::Matrix<Type, Matrix::RowsAtCompileTime,
+                       Matrix::ColsAtCompileTime,
+                       Matrix::PlainMatrix::Options>;
+};
+
+//! @brief Specialization of the resizing of the storage.
+//!
+//! @details The storage order of the matrix is preserved. The order of a
+//! vector is imposed by its shape, its resizing is column-major.
+template <eigen::is_eigen Matrix, std::size_t Rows, std::size_t Columns>
+struct typed_linear_algebra_internal::resizes<Matrix, Rows, Columns> {
+  [[nodiscard]] inline constexpr auto operator()() const
+      -> eigen::matrix<typename Matrix::Scalar, Rows, Columns,
+                       Matrix::PlainMatrix::IsRowMajor &&
+                               !Matrix::PlainMatrix::IsVectorAtCompileTime
+                           ? storage_order::row_major
+                           : storage_order::column_major>;
+};
+
+//! @brief Specialization of the allocation of the storage.
+//!
+//! @details Dynamically sized Eigen3 matrices allocate on evaluation.
+template <eigen::is_eigen Type>
+struct typed_linear_algebra_internal::allocates<Type> {
+  [[nodiscard]] inline constexpr bool operator()() const {
+    return Type::SizeAtCompileTime == Eigen::Dynamic;
+  }
+};
+
+//! @brief Specialization of the sum reduction.
+//!
+//! @details Eigen3 vectorized reduction.
+template <eigen::is_eigen Type, std::size_t Rows, std::size_t Columns>
+struct typed_linear_algebra_internal::sums<Type, Rows, Columns> {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    return value.sum();
+  }
+};
+
+//! @brief Specialization of the minimum reduction.
+template <eigen::is_eigen Type, std::size_t Rows, std::size_t Columns>
+struct typed_linear_algebra_internal::minimums<Type, Rows, Columns> {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    return value.minCoeff();
+  }
+};
+
+//! @brief Specialization of the maximum reduction.
+template <eigen::is_eigen Type, std::size_t Rows, std::size_t Columns>
+struct typed_linear_algebra_internal::maximums<Type, Rows, Columns> {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    return value.maxCoeff();
+  }
+};
+
+//! @brief Specialization of the trace reduction.
+template <eigen::is_eigen Type, std::size_t Size>
+struct typed_linear_algebra_internal::traces<Type, Size> {
+  [[nodiscard]] inline constexpr auto operator()(const Type &value) const {
+    return value.trace();
+  }
+};
+
+//! @brief Specialization of the dot product reduction.
+template <eigen::is_eigen Lhs, eigen::is_eigen Rhs, std::size_t Size>
+struct typed_linear_algebra_internal::dots<Lhs, Rhs, Size> {
+  [[nodiscard]] inline constexpr auto operator()(const Lhs &lhs,
+                                                 const Rhs &rhs) const {
+    return lhs.dot(rhs);
+  }
+};
+
+//! @brief Specialization of the finiteness.
+template <eigen::is_eigen Type, std::size_t Rows, std::size_t Columns>
+struct typed_linear_algebra_internal::finites<Type, Rows, Columns> {
+  [[nodiscard]] inline constexpr bool operator()(const Type &value) const {
+    return value.allFinite();
+  }
+};
+
+//! @brief Specialization of the symmetry.
+//!
+//! @details Eigen3 vectorized comparison of the matrix and its transpose.
+template <eigen::is_eigen Type, std::size_t Size>
+struct typed_linear_algebra_internal::symmetrics<Type, Size> {
+  [[nodiscard]] inline constexpr bool operator()(const Type &value,
+                                                 double tolerance) const {
+    const auto bound{static_cast<typename Type::Scalar>(tolerance)};
+
+    return ((value - value.transpose()).array().abs() <=
+            bound * value.array().abs().max(value.transpose().array().abs()))
+        .all();
+  }
+};
+
+//! @brief Specialization of the diagonal sign.
+template <eigen::is_eigen Type, std::size_t Size>
+struct typed_linear_algebra_internal::nonnegative_diagonals<Type, Size> {
+  [[nodiscard]] inline constexpr bool operator()(const Type &value) const {
+    return !(value.diagonal().array() < 0).any();
+  }
+};
+
+//! @brief Specialization of the transposition of a transposed expression.
+//!
+//! @details The transposition of a transposed expression is the nested
+//! expression, no transposition remains.
+template <typename Type>
+struct typed_linear_algebra_internal::transposes<Eigen::Transpose<Type>> {
+  [[nodiscard]] inline constexpr auto
+  operator()(const Eigen::Transpose<Type> &value) const {
+    return value.nestedExpression();
+  }
+};
 } // namespace fcarouge
 
 namespace Eigen {
+//! @brief Eigen3 traits of the dual numbers.
+//!
+//! @details The dual numbers are Eigen3 scalars. Their operations cost the
+//! operations of their lanes.
+template <typename Type, std::size_t Size>
+struct NumTraits<fcarouge::dual<Type, Size>> : NumTraits<Type> {
+  using Real = fcarouge::dual<Type, Size>;
+  using NonInteger = fcarouge::dual<Type, Size>;
+  using Literal = fcarouge::dual<Type, Size>;
+  using Nested = fcarouge::dual<Type, Size>;
+
+  enum {
+    IsComplex = 0,
+    IsInteger = 0,
+    IsSigned = 1,
+    RequireInitialization = 1,
+    ReadCost = static_cast<int>(Size + 1),
+    AddCost = static_cast<int>(Size + 1),
+    MulCost = static_cast<int>(2 * Size + 1)
+  };
+};
+
+//! @brief Eigen3 mixed operations of the dual numbers and their constants.
+template <typename Type, std::size_t Size, typename BinaryOp>
+struct ScalarBinaryOpTraits<fcarouge::dual<Type, Size>, Type, BinaryOp> {
+  using ReturnType = fcarouge::dual<Type, Size>;
+};
+
+//! @brief Eigen3 mixed operations of the constants and the dual numbers.
+template <typename Type, std::size_t Size, typename BinaryOp>
+struct ScalarBinaryOpTraits<Type, fcarouge::dual<Type, Size>, BinaryOp> {
+  using ReturnType = fcarouge::dual<Type, Size>;
+};
+
 //! @brief Eigen matrix solution to division.
 //!
 //! @details Argument-dependent lookup (ADL) used for type definition orgering
@@ -111,64 +298,81 @@ constexpr auto operator/(const Numerator &lhs, const Denominator &rhs)
 } // namespace Eigen
 
 //! @brief Specialization of the standard formatter for the Eigen matrix.
-template <typename Type, auto Row, auto Column, typename Char>
-struct std::formatter<fcarouge::eigen::matrix<Type, Row, Column>, Char> {
+//!
+//! @details The elements are formatted in place, without intermediate stream
+//! nor heap allocation.
+//!
+//! @note The formatter applies to every storage order of the matrix.
+template <typename Type, int Row, int Column, int Options, int MaxRow,
+          int MaxColumn, typename Char>
+struct std::formatter<
+    Eigen::Matrix<Type, Row, Column, Options, MaxRow, MaxColumn>, Char> {
+  using matrix = Eigen::Matrix<Type, Row, Column, Options, MaxRow, MaxColumn>;
+
   constexpr auto parse(std::basic_format_parse_context<Char> &parse_context) {
     return parse_context.begin();
   }
 
   template <typename OutputIterator>
   constexpr auto
-  format(const fcarouge::eigen::matrix<Type, Row, Column> &value,
+  format(const matrix &value,
          std::basic_format_context<OutputIterator, Char> &format_context) const
       -> OutputIterator {
-    const Eigen::IOFormat output_format{Eigen::StreamPrecision,
-                                        Eigen::DontAlignCols,
-                                        ", ",
-                                        ", ",
-                                        "[",
-                                        "]",
-                                        "",
-                                        "",
-                                        ' '};
-
-    return std::format_to(
-        format_context.out(), "[{}]",
-        (std::stringstream{} << value.format(output_format)).str());
+    format_context.advance_to(std::format_to(format_context.out(), "["));
+
+    for (Eigen::Index i{0}; i < value.rows(); ++i) {
+      if (i > 0) {
+        format_context.advance_to(std::format_to(format_context.out(), ", "));
+      }
+
+      format_context.advance_to(std::format_to(format_context.out(), "["));
+
+      for (Eigen::Index j{0}; j < value.cols(); ++j) {
+        if (j > 0) {
+          format_context.advance_to(std::format_to(format_context.out(), ", "));
+        }
+
+        format_context.advance_to(
+            std::format_to(format_context.out(), "{}", value(i, j)));
+      }
+
+      format_context.advance_to(std::format_to(format_context.out(), "]"));
+    }
+
+    format_context.advance_to(std::format_to(format_context.out(), "]"));
+
+    return format_context.out();
   }
 
   template <typename OutputIterator>
   constexpr auto
-  format(const fcarouge::eigen::matrix<Type, Row, Column> &value,
+  format(const matrix &value,
          std::basic_format_context<OutputIterator, Char> &format_context) const
       -> OutputIterator
-    requires(fcarouge::eigen::matrix<Type, Row, Column>::RowsAtCompileTime ==
-                 1 &&
-             fcarouge::eigen::matrix<Type, Row, Column>::ColsAtCompileTime != 1)
+    requires(matrix::RowsAtCompileTime == 1 && matrix::ColsAtCompileTime != 1)
   {
-    const Eigen::IOFormat output_format{Eigen::StreamPrecision,
-                                        Eigen::DontAlignCols,
-                                        ", ",
-                                        ", ",
-                                        "[",
-                                        "]",
-                                        "",
-                                        "",
-                                        ' '};
-
-    return std::format_to(
-        format_context.out(), "{}",
-        (std::stringstream{} << value.format(output_format)).str());
+    format_context.advance_to(std::format_to(format_context.out(), "["));
+
+    for (Eigen::Index j{0}; j < value.cols(); ++j) {
+      if (j > 0) {
+        format_context.advance_to(std::format_to(format_context.out(), ", "));
+      }
+
+      format_context.advance_to(
+          std::format_to(format_context.out(), "{}", value(0, j)));
+    }
+
+    format_context.advance_to(std::format_to(format_context.out(), "]"));
+
+    return format_context.out();
   }
 
   template <typename OutputIterator>
   constexpr auto
-  format(const fcarouge::eigen::matrix<Type, Row, Column> &value,
+  format(const matrix &value,
          std::basic_format_context<OutputIterator, Char> &format_context) const
       -> OutputIterator
-    requires(fcarouge::eigen::matrix<Type, Row, Column>::RowsAtCompileTime ==
-                 1 &&
-             fcarouge::eigen::matrix<Type, Row, Column>::ColsAtCompileTime == 1)
+    requires(matrix::RowsAtCompileTime == 1 && matrix::ColsAtCompileTime == 1)
   {
     return std::format_to(format_context.out(), "{}", value.value());
   }
@@ -46,9 +46,12 @@ namespace fcarouge {
 //! @{
 
 //! @brief Scalar type matrix with Eigen implementations.
-template <typename Type = double, std::size_t Row = 1, std::size_t Column = 1>
+//!
+//! @tparam Order The storage order of the elements of the matrix.
+template <typename Type = double, std::size_t Row = 1, std::size_t Column = 1,
+          storage_order Order = storage_order::column_major>
 using matrix =
-    typed_matrix<eigen::matrix<Type, Row, Column>,
+    typed_matrix<eigen::matrix<Type, Row, Column, Order>,
                  typed_linear_algebra_internal::tuple_n_type<Type, Row>,
                  typed_linear_algebra_internal::tuple_n_type<Type, Column>>;
 
@@ -56,8 +59,19 @@ using matrix =
 template <typename Type = double, std::size_t Row = 1>
 using column_vector = matrix<Type, Row, 1>;
 
+//! @brief Scalar type diagonal matrix with Eigen implementations.
+template <typename Type = double, std::size_t Size = 1>
+using diagonal_matrix = typed_diagonal_matrix<
+    eigen::column_vector<Type, Size>,
+    typed_linear_algebra_internal::tuple_n_type<Type, Size>,
+    typed_linear_algebra_internal::tuple_n_type<Type, Size>>;
+
 //! @}
 
 } // namespace fcarouge
 
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTANTIATION
+#include "fcarouge/instantiation.hpp"
+#endif
+
 #endif // FCAROUGE_LINALG_HPP
@@ -0,0 +1,252 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+//! @file
+//! @brief Heap allocation interception to support the tests.
+//!
+//! @details The replaceable global allocation and deallocation operators are
+//! defined here. Where the linker wraps the C allocation functions, the
+//! allocations of the linked code through `malloc` are observed as well, such
+//! as the dynamically sized Eigen3 matrices.
+
+#include "allocation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_WRAP_MALLOC
+extern "C" {
+void *__real_malloc(std::size_t size);
+void *__real_calloc(std::size_t count, std::size_t size);
+void *__real_realloc(void *pointer, std::size_t size);
+}
+#endif
+
+namespace fcarouge::test {
+namespace {
+//! @brief The depth of the no allocation scopes of the thread.
+thread_local std::size_t forbidden{0};
+
+//! @brief The count of heap allocations of the thread.
+thread_local std::size_t allocations{0};
+
+void record() noexcept {
+  ++allocations;
+
+  if (forbidden > 0) {
+    std::fputs("Heap allocation in a no allocation scope.\n", stderr);
+    std::abort();
+  }
+}
+
+[[nodiscard]] void *allocate(std::size_t size) noexcept {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_WRAP_MALLOC
+  return __real_malloc(size == 0 ? 1 : size);
+#else
+  return std::malloc(size == 0 ? 1 : size);
+#endif
+}
+
+//! @brief Over-aligned allocation stored with its unaligned allocation.
+//!
+//! @details The standard C aligned allocation is not portable to every
+//! supported platform.
+[[nodiscard]] void *allocate(std::size_t size,
+                             std::align_val_t alignment) noexcept {
+  const auto align{static_cast<std::size_t>(alignment)};
+  void *unaligned{allocate(size + align + sizeof(void *))};
+
+  if (!unaligned) {
+    return nullptr;
+  }
+
+  const auto address{reinterpret_cast<std::uintptr_t>(unaligned) +
+                     sizeof(void *)};
+  void *aligned{reinterpret_cast<void *>((address + align - 1) & ~(align - 1))};
+  static_cast<void **>(aligned)[-1] = unaligned;
+
+  return aligned;
+}
+
+void deallocate(void *pointer, std::align_val_t) noexcept {
+  if (pointer) {
+    std::free(static_cast<void **>(pointer)[-1]);
+  }
+}
+
+[[nodiscard]] void *allocate_or_throw(std::size_t size) {
+  record();
+
+  if (void *pointer{allocate(size)}) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+
+[[nodiscard]] void *allocate_or_throw(std::size_t size,
+                                      std::align_val_t alignment) {
+  record();
+
+  if (void *pointer{allocate(size, alignment)}) {
+    return pointer;
+  }
+
+  throw std::bad_alloc{};
+}
+} // namespace
+
+no_allocation::no_allocation() noexcept { ++forbidden; }
+
+no_allocation::~no_allocation() { --forbidden; }
+
+allocation_counter::allocation_counter() noexcept : start{allocations} {}
+
+std::size_t allocation_counter::count() const noexcept {
+  return allocations - start;
+}
+
+bool intercepts_malloc() noexcept {
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_WRAP_MALLOC
+  return true;
+#else
+  return false;
+#endif
+}
+} // namespace fcarouge::test
+
+namespace test = fcarouge::test;
+
+void *operator new(std::size_t size) { return test::allocate_or_throw(size); }
+
+void *operator new[](std::size_t size) {
+  return test::allocate_or_throw(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return test::allocate_or_throw(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return test::allocate_or_throw(size, alignment);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  test::record();
+  return test::allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  test::record();
+  return test::allocate(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t &) noexcept {
+  test::record();
+  return test::allocate(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t &) noexcept {
+  test::record();
+  return test::allocate(size, alignment);
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+
+void operator delete[](void *pointer) noexcept { std::free(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t alignment) noexcept {
+  test::deallocate(pointer, alignment);
+}
+
+void operator delete[](void *pointer, std::align_val_t alignment) noexcept {
+  test::deallocate(pointer, alignment);
+}
+
+void operator delete(void *pointer, std::size_t,
+                     std::align_val_t alignment) noexcept {
+  test::deallocate(pointer, alignment);
+}
+
+void operator delete[](void *pointer, std::size_t,
+                       std::align_val_t alignment) noexcept {
+  test::deallocate(pointer, alignment);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t alignment,
+                     const std::nothrow_t &) noexcept {
+  test::deallocate(pointer, alignment);
+}
+
+void operator delete[](void *pointer, std::align_val_t alignment,
+                       const std::nothrow_t &) noexcept {
+  test::deallocate(pointer, alignment);
+}
+
+#ifdef FCAROUGE_TYPED_LINEAR_ALGEBRA_WRAP_MALLOC
+extern "C" {
+void *__wrap_malloc(std::size_t size) {
+  test::record();
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(std::size_t count, std::size_t size) {
+  test::record();
+  return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *pointer, std::size_t size) {
+  test::record();
+  return __real_realloc(pointer, size);
+}
+}
+#endif
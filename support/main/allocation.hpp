@@ -0,0 +1,93 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_ALLOCATION_HPP
+#define FCAROUGE_ALLOCATION_HPP
+
+//! @file
+//! @brief Heap allocation interception to support the tests.
+//!
+//! @details The global allocation and deallocation operators are replaced, and
+//! the C allocation functions are wrapped where the linker supports it, to
+//! observe the heap allocations of the calling thread.
+
+#include <cstddef>
+
+namespace fcarouge::test {
+
+//! @name Types
+//! @{
+
+//! @brief Fails on any heap allocation of the thread within its scope.
+//!
+//! @details The program is aborted at the point of the allocation for the
+//! offending call stack to be inspected. The scopes nest.
+class no_allocation {
+public:
+  no_allocation() noexcept;
+  no_allocation(const no_allocation &other) = delete;
+  no_allocation &operator=(const no_allocation &other) = delete;
+  ~no_allocation();
+};
+
+//! @brief Counts the heap allocations of the thread within its scope.
+//!
+//! @details Dynamically sized types are expected to allocate, the count
+//! verifies their allocations.
+class allocation_counter {
+public:
+  allocation_counter() noexcept;
+  allocation_counter(const allocation_counter &other) = delete;
+  allocation_counter &operator=(const allocation_counter &other) = delete;
+
+  //! @brief The count of heap allocations since the construction.
+  [[nodiscard]] std::size_t count() const noexcept;
+
+private:
+  std::size_t start;
+};
+
+//! @}
+
+//! @name Functions
+//! @{
+
+//! @brief The C allocation functions are intercepted.
+//!
+//! @details Only the allocation operators are intercepted on the platforms
+//! where the linker cannot wrap the C allocation functions.
+[[nodiscard]] bool intercepts_malloc() noexcept;
+
+//! @}
+
+} // namespace fcarouge::test
+
+#endif // FCAROUGE_ALLOCATION_HPP
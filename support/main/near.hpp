@@ -0,0 +1,68 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_NEAR_HPP
+#define FCAROUGE_NEAR_HPP
+
+//! @file
+//! @brief Approximate comparison of the matrices to support the tests.
+
+#include <cmath>
+#include <cstddef>
+
+namespace fcarouge::test {
+
+//! @name Functions
+//! @{
+
+//! @brief The matrices are element-wise equal within the absolute tolerance.
+//!
+//! @details The matrices are compared through their element accessors, of the
+//! size of the left hand side matrix.
+template <typename Lhs, typename Rhs>
+[[nodiscard]] bool near(const Lhs &lhs, const Rhs &rhs,
+                        double tolerance = 1e-12) {
+  for (std::size_t i{0}; i < Lhs::rows; ++i) {
+    for (std::size_t j{0}; j < Lhs::columns; ++j) {
+      if (std::abs(lhs(i, j) - rhs(i, j)) > tolerance) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+//! @}
+
+} // namespace fcarouge::test
+
+#endif // FCAROUGE_NEAR_HPP
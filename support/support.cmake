@@ -35,8 +35,9 @@ For more information, please refer to <https://unlicense.org> ]]
 #
 # * NAME The name of the test file without extension.
 # * BACKENDS Optional list of backends to use against the test.
+# * LIBRARIES Optional list of support libraries to link against the test.
 function(test TEST_NAME)
-  set(multiValueArgs BACKENDS)
+  set(multiValueArgs BACKENDS LIBRARIES)
   cmake_parse_arguments(PARSE_ARGV 0 TEST "" "${oneValueArgs}"
                         "${multiValueArgs}")
 
@@ -52,7 +53,7 @@ function(test TEST_NAME)
     target_link_libraries(
       typed_linear_algebra_test_${BACKEND}_${TEST_NAME}_driver
       PRIVATE typed_linear_algebra_main typed_linear_algebra_${BACKEND}
-              typed_linear_algebra_options)
+              typed_linear_algebra_options ${TEST_LIBRARIES})
     separate_arguments(TEST_COMMAND UNIX_COMMAND $ENV{COMMAND})
     add_test(
       NAME typed_linear_algebra_test_${BACKEND}_${TEST_NAME}
@@ -0,0 +1,96 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "allocation.hpp"
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <format>
+#include <utility>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the fixed-size operators, constructors, and formatters do not
+//! allocate, and counts the allocations of the dynamically sized matrices.
+[[maybe_unused]] auto test{[] {
+  char buffer[256]{};
+
+  {
+    const no_allocation guard;
+
+    matrix<double, 2, 2> a{{1.0, 2.0}, {3.0, 4.0}};
+    const matrix<double, 2, 2> b{{5.0, 6.0}, {7.0, 8.0}};
+    const matrix<double, 1, 2> r{1.0, 2.0};
+    const column_vector<double, 2> c{3.0, 4.0};
+    const matrix<double, 1, 1> s{2.0};
+    matrix<double, 2, 2> copied{a};
+    matrix<double, 2, 2> moved{std::move(copied)};
+    matrix<double, 2, 2> assigned;
+
+    assigned = b;
+    moved = std::move(assigned);
+    a(0, 1) = 2.5;
+
+    const matrix<double, 2, 2> product{a * b};
+    const matrix<double, 2, 2> sum{a + b};
+    const matrix<double, 2, 2> difference{a - b};
+    const matrix<double, 2, 2> scaled_left{2.0 * a};
+    const matrix<double, 2, 2> scaled_right{a * 2.0};
+    const matrix<double, 2, 2> divided{a / 2.0};
+    const matrix<double, 2, 2> quotient{a / b};
+    const column_vector<double, 2> transformed{a * c};
+    const double inner{r * c};
+
+    assert(product == a * b);
+    assert(sum == a + b);
+    assert(difference == a - b);
+    assert(scaled_left == scaled_right);
+    assert(divided == a / 2.0);
+    assert(quotient == a / b);
+    assert(transformed == a * c);
+    assert(inner == 11.0);
+    assert(moved == b);
+
+    std::format_to(buffer, "{} {} {} {}", a, r, c, s);
+  }
+
+  using dynamic = eigen::matrix<double, Eigen::Dynamic, Eigen::Dynamic>;
+  const allocation_counter counter;
+  const dynamic d{dynamic::Identity(2, 2)};
+  const dynamic e{d * d};
+
+  assert(e == d);
+  assert(counter.count() >= 2 || !intercepts_malloc());
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,83 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the batches and the snapshots of typed matrices allocate
+//! their storage on the huge pages, first touched by the allocating thread.
+[[maybe_unused]] auto test{[] {
+  using state = matrix<double, 2, 2>;
+  const state a{{1.0, 2.0}, {3.0, 4.0}};
+
+  std::vector<state, huge_page_allocator<state>> huge(1000, a);
+
+  assert(reinterpret_cast<std::uintptr_t>(huge.data()) % (2 * 1024 * 1024) ==
+         0);
+  assert(huge[999] == a);
+
+  std::vector<state, node_local_allocator<state>> local;
+
+  local.reserve(100'000);
+  local.push_back(a);
+
+  assert(reinterpret_cast<std::uintptr_t>(local.data()) % (2 * 1024 * 1024) ==
+         0);
+  assert(local.front() * a == a * a);
+
+  const node_local_allocator<double> rebound{local.get_allocator()};
+
+  assert(rebound == local.get_allocator());
+
+  typed_snapshot<state, node_local_allocator<state>> writer{a};
+  const typed_snapshot<state, node_local_allocator<state>> reader{writer};
+
+  assert(reader.acquire() == writer.acquire());
+
+  writer.update([](state &value) { value.at<0, 0>() = 0.0; });
+
+  assert((reader.acquire()->at<0, 0>() == 1.0));
+  assert((writer.acquire()->at<0, 0>() == 0.0));
+
+  const typed_snapshot<state> shared{a};
+
+  assert(*shared.acquire() == a);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -37,8 +37,7 @@ namespace fcarouge::test {
 namespace {
 //! @test Verifies the identity matrices values are unit diagonals.
 [[maybe_unused]] auto test{[] {
-  //! @todo Support a const version of `at()`.
-  matrix<double, 3, 3> i{{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}};
+  const matrix<double, 3, 3> i{{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}};
 
   assert((i.at<0, 0>() == 1.0));
   assert((i.at<0, 1>() == 0.0));
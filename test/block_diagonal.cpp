@@ -0,0 +1,83 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the block-wise products, divisions, inversion, Cholesky
+//! factorization and solutions of the block diagonal matrices against their
+//! dense equivalents. A block that is not positive definite fails the whole
+//! factorization.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 2, 2> a{{4.0, 1.0}, {1.0, 3.0}};
+  const matrix<double, 1, 1> b{2.0};
+  const matrix<double, 3, 3> c{
+      {4.0, 2.0, 0.4}, {2.0, 5.0, 1.0}, {0.4, 1.0, 3.0}};
+  const typed_block_diagonal_matrix p{a, b, c};
+  const matrix<double, 6, 6> dense{p};
+
+  static_assert(p.rows == 6 && p.columns == 6);
+  static_assert(p.offsets[0] == 0 && p.offsets[1] == 2 && p.offsets[2] == 3);
+  assert((p.block<1>() == b));
+  assert(dense(0, 1) == 1.0 && dense(2, 2) == 2.0 && dense(3, 5) == 0.4);
+  assert(dense(0, 2) == 0.0 && dense(5, 0) == 0.0 && dense(2, 3) == 0.0);
+
+  const matrix<double, 6, 2> x{{1.0, 2.0},  {3.0, 4.0},  {5.0, 6.0},
+                               {7.0, 8.0},  {9.0, 1.0},  {2.0, 3.0}};
+  const matrix<double, 2, 6> y{transpose(x)};
+
+  assert(near(p * x, dense * x));
+  assert(near(y * p, y * dense));
+  assert(near(y / p, y / dense));
+  assert(near(matrix<double, 6, 6>{inverse(p)} * dense,
+              matrix<double, 6, 6>{identity<matrix<double, 6, 6>>()}));
+
+  const auto l{*cholesky(p)};
+  const auto u{*cholesky<triangle::upper>(p)};
+
+  assert(near(matrix<double, 6, 6>{reconstruct(l)}, dense));
+  assert(near(matrix<double, 6, 6>{reconstruct(u)}, dense));
+  assert(near(dense * solve_upper(l, solve_lower(l, x)), x));
+  assert(near(dense * solve_upper(u, solve_lower(u, x)), x));
+
+  const matrix<double, 1, 1> negative{-2.0};
+
+  assert(!cholesky(typed_block_diagonal_matrix{a, negative, c}));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
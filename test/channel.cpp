@@ -0,0 +1,101 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace fcarouge::test {
+namespace {
+//! @brief A matrix of the same value for every element.
+matrix<double, 3, 3> uniform(double value) {
+  matrix<double, 3, 3> result;
+
+  for (std::size_t i{0}; i < 3; ++i) {
+    for (std::size_t j{0}; j < 3; ++j) {
+      result(i, j) = value;
+    }
+  }
+
+  return result;
+}
+
+//! @test Verifies the loads of the channel return the freshest stored typed
+//! matrix, never a mix of two stores, while the writer stores concurrently.
+[[maybe_unused]] auto test{[] {
+  typed_channel<matrix<double, 3, 3>> channel;
+
+  assert(channel.version() == 0);
+  assert(channel.load() == uniform(0.0));
+
+  const matrix<double, 3, 3> a{
+      {1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}};
+
+  channel.store(a);
+
+  assert(channel.version() == 1);
+  assert(channel.load() == a);
+
+  constexpr double stores{20000.0};
+  std::atomic<bool> done{false};
+
+  std::thread reader{[&channel, &done, &a] {
+    double previous{0.0};
+
+    while (!done.load(std::memory_order_acquire)) {
+      const matrix<double, 3, 3> value{channel.load()};
+      const double first{value(0, 0)};
+
+      assert(first >= previous);
+      assert(value == uniform(first) || value == a);
+
+      previous = value == a ? previous : first;
+    }
+  }};
+
+  for (double k{1.0}; k <= stores; k += 1.0) {
+    channel.store(uniform(k));
+  }
+
+  done.store(true, std::memory_order_release);
+  reader.join();
+
+  assert(channel.version() == 1 + static_cast<std::uint64_t>(stores));
+  assert(channel.load() == uniform(stores));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,86 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the Cholesky factorization, its rank-one updates, triangular
+//! solutions, and square-root propagation against their dense equivalents, and
+//! the rejection of the matrices that are not positive definite.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 3, 3> p{
+      {4.0, 2.0, 0.4}, {2.0, 5.0, 1.0}, {0.4, 1.0, 3.0}};
+  const matrix<double, 3, 1> v{1.0, -2.0, 0.5};
+  const matrix<double, 3, 1> b{1.0, 2.0, 3.0};
+  auto l{*cholesky(p)};
+  const auto u{*cholesky<triangle::upper>(p)};
+
+  assert(near(reconstruct(l), p));
+  assert(near(reconstruct(u), p));
+  assert(near(solve_upper(l, solve_lower(l, b)), transpose(transpose(b) / p)));
+
+  assert(l.rank_update(v, 2.0));
+  assert(near(reconstruct(l), p + 2.0 * (v * transpose(v))));
+
+  assert(l.rank_update(v, -2.0));
+  assert(near(reconstruct(l), p));
+
+  const matrix<double, 3, 1> x{solve_upper(u, solve_lower(u, b))};
+
+  assert(near(p * x, b));
+
+  const matrix<double, 3, 3> f{
+      {1.0, 0.1, 0.0}, {0.0, 1.0, 0.1}, {0.0, 0.0, 1.0}};
+  const matrix<double, 3, 3> q{
+      {0.1, 0.0, 0.0}, {0.0, 0.2, 0.0}, {0.0, 0.0, 0.3}};
+
+  assert(near(reconstruct(propagate(l, f, *cholesky(q))),
+              f * p * transpose(f) + q));
+
+  const matrix<double, 3, 3> indefinite{
+      {1.0, 2.0, 0.0}, {2.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+  const matrix<double, 3, 3> singular{
+      {1.0, 1.0, 0.0}, {1.0, 1.0, 0.0}, {0.0, 0.0, 1.0}};
+
+  assert(!cholesky(indefinite));
+  assert(!cholesky<triangle::upper>(indefinite));
+  assert(!cholesky(singular));
+  assert(!cholesky(-1.0 * p));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,67 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the nested array and variadic constructors store the same
+//! values as the Eigen comma initializer.
+[[maybe_unused]] auto test{[] {
+  const double a[2][3]{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const matrix<double, 2, 3> m{a};
+  Eigen::Matrix<double, 2, 3> e;
+  e << 1.0, 2.0, 3.0, 4.0, 5.0, 6.0;
+
+  assert(m.data == e);
+  assert(m(0, 0) == 1.0);
+  assert(m(0, 2) == 3.0);
+  assert(m(1, 0) == 4.0);
+  assert(m(1, 2) == 6.0);
+
+  const column_vector<double, 4> c{1.0, 2.0, 3.0, 4.0};
+  Eigen::Vector<double, 4> v;
+  v << 1.0, 2.0, 3.0, 4.0;
+
+  assert(c.data == v);
+
+  const matrix<double, 1, 3> r{1.0, 2.0, 3.0};
+  Eigen::RowVector<double, 3> w;
+  w << 1.0, 2.0, 3.0;
+
+  assert(r.data == w);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,82 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the diagonal matrix products, sums, inversion, and division
+//! against their dense equivalents.
+[[maybe_unused]] auto test{[] {
+  const diagonal_matrix<double, 3> d{1.0, 2.0, 4.0};
+  const matrix<double, 3, 3> dense{d};
+  const matrix<double, 3, 2> a{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+  const matrix<double, 2, 3> b{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+
+  static_assert(sizeof(d) == 3 * sizeof(double));
+  assert(dense(0, 0) == 1.0);
+  assert(dense(1, 1) == 2.0);
+  assert(dense(2, 2) == 4.0);
+  assert(dense(0, 1) == 0.0);
+  assert(dense(2, 0) == 0.0);
+
+  static_assert(std::is_same_v<decltype(d * a), matrix<double, 3, 2>>);
+  assert(d * a == dense * a);
+  assert(b * d == b * dense);
+  assert(dense + d == dense + dense);
+  assert(d + dense == dense + dense);
+  assert(dense - d == (dense - dense));
+
+  const diagonal_matrix<double, 3> dd{d * d};
+  const diagonal_matrix<double, 3> s{d + d};
+
+  assert(dd == (diagonal_matrix<double, 3>{1.0, 4.0, 16.0}));
+  assert(s == (diagonal_matrix<double, 3>{2.0, 4.0, 8.0}));
+  assert(inverse(d) == (diagonal_matrix<double, 3>{1.0, 0.5, 0.25}));
+  assert(d * inverse(d) == (diagonal_matrix<double, 3>{1.0, 1.0, 1.0}));
+  assert(d / d == (diagonal_matrix<double, 3>{1.0, 1.0, 1.0}));
+
+  const matrix<double, 2, 3> q{b / d};
+
+  assert(q(0, 0) == 1.0);
+  assert(q(0, 1) == 1.0);
+  assert(q(0, 2) == 0.75);
+  assert(q(1, 0) == 4.0);
+  assert(q(1, 1) == 2.5);
+  assert(q(1, 2) == 1.5);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
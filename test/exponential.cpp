@@ -0,0 +1,94 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the matrix exponential, the Van Loan discretization of a
+//! constant velocity model, the reuse of the cached discretizations, and the
+//! termination on the infinite elements.
+[[maybe_unused]] auto test{[] {
+  const double pi{std::numbers::pi};
+  const matrix<double, 2, 2> rotation{{0.0, -3.0 * pi}, {3.0 * pi, 0.0}};
+
+  assert(near(exp(rotation), matrix<double, 2, 2>{{-1.0, 0.0}, {0.0, -1.0}}));
+  assert(near(exp(matrix<double, 2, 2>{{1.0, 0.0}, {0.0, -2.0}}),
+              matrix<double, 2, 2>{{std::exp(1.0), 0.0},
+                                   {0.0, std::exp(-2.0)}}));
+
+  const matrix<double, 2, 2> a{{0.0, 1.0}, {0.0, 0.0}};
+  const matrix<double, 2, 1> g{0.0, 1.0};
+  const matrix<double, 1, 1> qc{0.5};
+  const double dt{0.1};
+
+  assert(near(exp(a * dt), matrix<double, 2, 2>{{1.0, dt}, {0.0, 1.0}}));
+
+  const auto [f, q]{discretize(a, g, qc, dt)};
+
+  assert(near(f, matrix<double, 2, 2>{{1.0, dt}, {0.0, 1.0}}));
+  assert(near(q, matrix<double, 2, 2>{
+                     {0.5 * dt * dt * dt / 3.0, 0.5 * dt * dt / 2.0},
+                     {0.5 * dt * dt / 2.0, 0.5 * dt}}));
+
+  discretization_cache<matrix<double, 2, 2>, matrix<double, 2, 1>,
+                       matrix<double, 1, 1>, 2>
+      cache{a, g, qc};
+  const auto *first{&cache(dt)};
+
+  assert(near(first->first, f));
+  assert(near(first->second, q));
+  assert(&cache(dt) == first);
+  assert(&cache(0.2) != first);
+  assert(&cache(dt) == first);
+  assert(near(cache(0.3).first, exp(a * 0.3)));
+  assert(&cache(dt) == first);
+
+  const double infinity{std::numeric_limits<double>::infinity()};
+  const auto e{exp(matrix<double, 2, 2>{{1.0, infinity}, {0.0, 1.0}})};
+
+  assert(std::isnan(e(0, 0)) && std::isnan(e(1, 1)));
+
+  const auto [nan_f, nan_q]{
+      discretize(matrix<double, 2, 2>{{0.0, infinity}, {0.0, 0.0}}, g, qc, dt)};
+
+  assert(std::isnan(nan_f(0, 1)) && std::isnan(nan_q(1, 1)));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,132 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+//! @brief A length index type of the given power, layout compatible with its
+//! underlying value.
+template <int Power> struct length {
+  double value;
+};
+
+template <int Lhs, int Rhs>
+length<Lhs + Rhs> operator*(length<Lhs> lhs, length<Rhs> rhs);
+
+//! @brief A typed matrix of mixed length powers elements.
+using mixed = typed_matrix<eigen::matrix<double, 2, 3>,
+                           std::tuple<length<0>, length<1>>,
+                           std::tuple<length<0>, length<1>, length<2>>>;
+} // namespace
+} // namespace fcarouge::test
+
+template <int Power>
+struct fcarouge::typed_linear_algebra_internal::element_traits<
+    double, fcarouge::test::length<Power>> {
+  using type = fcarouge::test::length<Power>;
+
+  [[nodiscard]] static inline constexpr double to_underlying(type value) {
+    return value.value;
+  }
+
+  [[nodiscard]] static inline type &from_underlying(double &value) {
+    return *std::bit_cast<type *>(&value);
+  }
+
+  [[nodiscard]] static inline const type &
+  from_underlying(const double &value) {
+    return *std::bit_cast<const type *>(&value);
+  }
+};
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the compile-time traversals of the typed elements in the
+//! row-major and column-major orders, with and without their positions. The
+//! elements of a mixed-type matrix are visited with their own types.
+[[maybe_unused]] auto test{[] {
+  matrix<double, 2, 3> m{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const auto &c{m};
+  std::array<double, 6> visited{};
+  std::size_t count{0};
+
+  for_each_element(c, [&visited, &count](const auto &value) {
+    static_assert(std::is_same_v<decltype(value), const double &>);
+    visited[count++] = value;
+  });
+
+  assert((visited == std::array{1.0, 2.0, 3.0, 4.0, 5.0, 6.0}));
+
+  count = 0;
+  for_each_element<storage_order::column_major>(
+      c, [&visited, &count](const auto &value) { visited[count++] = value; });
+
+  assert((visited == std::array{1.0, 4.0, 2.0, 5.0, 3.0, 6.0}));
+
+  for_each_element(c, [&c](const auto &value, auto i, auto j) {
+    static_assert(i < 2 && j < 3);
+    assert((value == c.at<i, j>()));
+  });
+
+  for_each_element(m, [](auto &value) { value *= 2.0; });
+
+  assert(m == (matrix<double, 2, 3>{{2.0, 4.0, 6.0}, {8.0, 10.0, 12.0}}));
+
+  mixed lengths{m.data};
+  std::size_t visits{0};
+
+  for_each_element(lengths, [&lengths, &visits](auto &value, auto i, auto j) {
+    static_assert(
+        std::is_same_v<decltype(value), tla::element<mixed, i, j> &>);
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(value)>,
+                                 length<int{i} + int{j}>>);
+    assert(&value.value == &lengths.data(std::size_t{i}, std::size_t{j}));
+    value.value += 1.0;
+    ++visits;
+  });
+
+  assert(visits == 6);
+  assert(lengths.data(0, 0) == 3.0 && lengths.data(1, 2) == 13.0);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
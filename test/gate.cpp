@@ -0,0 +1,117 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <vector>
+
+namespace fcarouge::test {
+namespace {
+template <typename Innovation>
+concept gateable =
+    requires(std::vector<column_vector<double, 2>> values,
+             std::vector<Innovation> innovations,
+             std::vector<std::tuple<std::size_t, std::size_t, double>> gated) {
+      gate(values, innovations, values, 1.0, std::back_inserter(gated));
+    };
+
+//! @test Verifies the batch gating of measurements against tracks matches the
+//! pairwise Mahalanobis distances, across several blocks of measurements. The
+//! track whose covariance is not positive definite gates no measurement. The
+//! covariances are square and indexed by the rows of the measurements.
+[[maybe_unused]] auto test{[] {
+  static_assert(gateable<matrix<double, 2, 2>>);
+  static_assert(!gateable<matrix<double, 3, 3>>);
+  static_assert(!gateable<matrix<double, 2, 3>>);
+  static_assert(!gateable<matrix<float, 2, 2>>);
+
+  const std::array predictions{column_vector<double, 2>{0.0, 0.0},
+                               column_vector<double, 2>{10.0, -5.0}};
+  const std::array innovations{matrix<double, 2, 2>{{4.0, 1.0}, {1.0, 2.0}},
+                               matrix<double, 2, 2>{{1.0, 0.0}, {0.0, 9.0}}};
+  std::vector<column_vector<double, 2>> measurements;
+
+  for (std::size_t k{0}; k < 37; ++k) {
+    const double t{static_cast<double>(k)};
+
+    measurements.push_back(
+        column_vector<double, 2>{t / 3.0, std::sin(t) * 4.0 - t / 6.0});
+  }
+
+  const double threshold{9.21};
+  std::vector<std::tuple<std::size_t, std::size_t, double>> gated;
+
+  gate(predictions, innovations, measurements, threshold,
+       std::back_inserter(gated));
+
+  std::size_t expected{0};
+
+  for (std::size_t track{0}; track < predictions.size(); ++track) {
+    for (std::size_t m{0}; m < measurements.size(); ++m) {
+      const column_vector<double, 2> y{measurements[m] - predictions[track]};
+      const double distance{transpose(y) / innovations[track] * y};
+
+      if (distance <= threshold) {
+        const auto [t, j, d]{gated[expected]};
+
+        assert(t == track);
+        assert(j == m);
+        assert(std::abs(d - distance) < 1e-9);
+        ++expected;
+      }
+    }
+  }
+
+  assert(expected == gated.size());
+  assert(expected > 0);
+
+  const std::array indefinite{matrix<double, 2, 2>{{1.0, 2.0}, {2.0, 1.0}},
+                              innovations[1]};
+  std::vector<std::tuple<std::size_t, std::size_t, double>> remaining;
+
+  gate(predictions, indefinite, measurements, threshold,
+       std::back_inserter(remaining));
+
+  assert(!remaining.empty());
+  assert(std::ranges::all_of(
+      remaining, [](const auto &pair) { return std::get<0>(pair) == 1; }));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,138 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_HEALTH
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_HEALTH
+#endif
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <string_view>
+#include <tuple>
+
+namespace fcarouge::test {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+struct area {
+  double value;
+};
+
+struct meter {
+  double value;
+};
+
+[[maybe_unused]] area operator*(meter lhs, meter rhs) {
+  return {lhs.value * rhs.value};
+}
+
+using meters = std::tuple<meter, meter>;
+
+//! @brief A matrix of squared meters, covariances and transitions alike.
+using covariance = typed_matrix<eigen::matrix<double, 2, 2>, meters, meters>;
+
+std::size_t reports{0};
+health::diagnosis last{};
+
+//! @test Verifies the non-finite results of the typed operations are reported
+//! to the monitor, and only them. The symmetry and the diagonal sign of the
+//! covariances are only inspected on request.
+[[maybe_unused]] auto test{[] {
+  health::monitor_with([](const health::diagnosis &value) {
+    ++reports;
+    last = value;
+  });
+
+  const matrix<double, 2, 2> a{{1.0, 2.0}, {3.0, 4.0}};
+  const matrix<double, 2, 2> b{
+      {1.0, std::numeric_limits<double>::quiet_NaN()}, {3.0, 4.0}};
+
+  [[maybe_unused]] const matrix<double, 2, 2> c{a * a + a - 2.0 * a};
+
+  assert(reports == 0);
+
+  [[maybe_unused]] const matrix<double, 2, 2> d{a + b};
+
+  assert(reports == 1);
+  assert(last.operation == "sum");
+  assert(last.rows == 2 && last.columns == 2);
+  assert(last.non_finite && !last.asymmetric && !last.negative_diagonal);
+
+  covariance p{a.data + a.data.transpose()};
+  const covariance f{a.data};
+
+  [[maybe_unused]] const covariance q{f * p * transpose(f)};
+
+  assert(reports == 1);
+
+  const health::diagnosis healthy{health::inspect_covariance(q)};
+
+  assert(reports == 1);
+  assert(!healthy.non_finite && !healthy.asymmetric &&
+         !healthy.negative_diagonal);
+
+  p.data(0, 1) += 1e-3;
+
+  [[maybe_unused]] const covariance r{p + p};
+
+  assert(reports == 1);
+
+  const health::diagnosis asymmetric{health::inspect_covariance(r)};
+
+  assert(reports == 2);
+  assert(last.operation == "covariance");
+  assert(!asymmetric.non_finite && asymmetric.asymmetric &&
+         !asymmetric.negative_diagonal);
+
+  health::tolerate(1e-2);
+
+  const covariance s{p - p * 2.0};
+  const health::diagnosis negative{
+      health::inspect_covariance(s, "difference")};
+
+  assert(reports == 3);
+  assert(last.operation == "difference");
+  assert(!negative.non_finite && !negative.asymmetric &&
+         negative.negative_diagonal);
+
+  health::monitor_with(nullptr);
+
+  [[maybe_unused]] const matrix<double, 2, 2> e{a + b};
+
+  assert(reports == 3);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
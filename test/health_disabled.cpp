@@ -0,0 +1,61 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cstddef>
+
+namespace fcarouge::test {
+namespace {
+std::size_t reports{0};
+
+//! @test Verifies the tolerance and the inspections of the covariances apply
+//! without the health monitor, and the monitor is only called when enabled.
+[[maybe_unused]] auto test{[] {
+  health::monitor_with([](const health::diagnosis &) { ++reports; });
+
+  matrix<double, 2, 2> p{{2.0, 1.0}, {1.0, 2.0}};
+
+  p(0, 1) += 1e-3;
+
+  assert(health::inspect_covariance(p).asymmetric);
+  assert(reports == (health::enabled ? 1 : 0));
+
+  health::tolerate(1e-2);
+
+  assert(!health::inspect_covariance(p).asymmetric);
+  assert(reports == (health::enabled ? 1 : 0));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
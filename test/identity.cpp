@@ -37,7 +37,7 @@ namespace fcarouge::test {
 namespace {
 //! @test Verifies the identity matrices values are unit diagonals.
 [[maybe_unused]] auto test{[] {
-  const matrix<double, 3, 3> i{{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}};
+  const matrix<double, 3, 3> i{identity<matrix<double, 3, 3>>()};
 
   assert(i(0, 0) == 1.0);
   assert(i(0, 1) == 0.0);
@@ -0,0 +1,72 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+//! @test Verifies the typed operators evaluate through the explicitly
+//! instantiated kernels of the storages of the common sizes.
+[[maybe_unused]] auto test{[] {
+  static_assert(std::is_same_v<tla::evaluate<tla::product<
+                                   eigen::matrix<double, 3, 1>,
+                                   eigen::matrix<double, 1, 3>>>,
+                               eigen::matrix<double, 3, 3>>);
+  static_assert(std::is_same_v<tla::evaluate<tla::quotient<
+                                   eigen::matrix<double, 1, 3>,
+                                   eigen::matrix<double, 2, 3>>>,
+                               eigen::matrix<double, 1, 2>>);
+
+  const matrix<double, 2, 3> a{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const matrix<double, 3, 2> b{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+  const matrix<double, 2, 2> c{a * b};
+  const matrix<double, 2, 2> d{c + c - c};
+  const matrix<double, 2, 2> i{c / c};
+
+  assert(c == (matrix<double, 2, 2>{{22.0, 28.0}, {49.0, 64.0}}));
+  assert(d == c);
+  assert(i(0, 0) > 0.999 && i(0, 0) < 1.001);
+  assert(i(1, 0) > -0.001 && i(1, 0) < 0.001);
+
+  const diagonal_matrix<double, 2> s{2.0, 3.0};
+
+  assert(s * c == (matrix<double, 2, 2>{{44.0, 56.0}, {147.0, 192.0}}));
+  assert(c * s == (matrix<double, 2, 2>{{44.0, 84.0}, {98.0, 192.0}}));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,107 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#ifndef FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+#define FCAROUGE_TYPED_LINEAR_ALGEBRA_INSTRUMENTATION
+#endif
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <source_location>
+#include <string_view>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the work of the typed operations is counted in the site of
+//! their innermost scope, the simplified identity and zero operations being
+//! free.
+[[maybe_unused]] auto test{[] {
+  instrumentation::report_at_exit(nullptr);
+
+  const matrix<double, 2, 3> a{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const matrix<double, 3, 2> b{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+  instrumentation::site predict{"predict"};
+  instrumentation::site update{"update"};
+
+  {
+    const instrumentation::scope predicting{predict};
+    const matrix<double, 2, 2> p{a * b};
+
+    {
+      const instrumentation::scope updating{update};
+      const matrix<double, 2, 2> q{(p + p) / p};
+    }
+
+    const matrix<double, 2, 2> r{2.0 * p};
+    const matrix<double, 2, 2> i{identity<matrix<double, 2, 2>>() * p};
+    const matrix<double, 2, 2> z{p + zero<matrix<double, 2, 2>>()};
+  }
+
+  const instrumentation::counters predicted{predict.value()};
+
+  assert(predicted.operations == 2);
+  assert(predicted.flops == 2 * 2 * 3 * 2 + 2 * 2);
+  assert(predicted.temporaries == 2);
+  assert(predicted.decompositions == 0);
+  assert(predicted.allocations == 0);
+  assert(predicted.bytes == (6 + 6 + 4 + 4 + 4) * sizeof(double));
+
+  const instrumentation::counters updated{update.value()};
+
+  assert(updated.operations == 2);
+  assert(updated.flops == 4 + (2 * 2 * 2 * 2 - 2 * 2 * 2 * 2 / 3) +
+                              2 * (4 * 2 * 2 + 2 * 2));
+  assert(updated.temporaries == 2);
+  assert(updated.decompositions == 1);
+  assert(updated.bytes == (4 + 4 + 4 + 4 + 4 + 4) * sizeof(double));
+
+  const matrix<double, 2, 2> s{a * b};
+  std::size_t sites{0};
+
+  instrumentation::report([&sites](std::string_view name,
+                                   const std::source_location &location,
+                                   const instrumentation::counters &value) {
+    assert(location.line() > 0);
+
+    if (name == "unscoped") {
+      assert(value.operations > 0);
+    }
+
+    ++sites;
+  });
+
+  assert(sites == 3);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
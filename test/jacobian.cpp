@@ -0,0 +1,139 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <tuple>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+//! @brief A typed column vector of the underlying element type.
+template <typename Type, std::size_t Row>
+using vector =
+    typed_matrix<eigen::matrix<Type, Row, 1>,
+                 typed_linear_algebra_internal::tuple_n_type<double, Row>,
+                 typed_linear_algebra_internal::tuple_n_type<double, 1>>;
+
+//! @brief A length index type raised to a power.
+template <int Power> struct length {
+  double value;
+};
+
+template <int Lhs, int Rhs>
+[[maybe_unused]] length<Lhs + Rhs> operator*(length<Lhs> lhs,
+                                             length<Rhs> rhs) {
+  return {lhs.value * rhs.value};
+}
+
+template <int Power>
+[[maybe_unused]] length<Power> operator*(length<Power> lhs, double rhs) {
+  return {lhs.value * rhs};
+}
+
+template <int Power>
+[[maybe_unused]] length<Power> operator*(double lhs, length<Power> rhs) {
+  return {lhs * rhs.value};
+}
+
+using lengths = std::tuple<length<1>, length<1>>;
+using per_lengths = std::tuple<length<-1>, length<-1>>;
+using unit = std::tuple<double>;
+
+//! @test Verifies the forward-mode automatic differentiation Jacobians of a
+//! nonlinear model and of a linear model against their analytical Jacobians.
+//! The Jacobian of distinct index types composes with its column vector and
+//! covariance.
+[[maybe_unused]] auto test{[] {
+  const column_vector<double, 2> x{0.5, 2.0};
+
+  const auto nonlinear{[](const auto &state) {
+    using type = std::remove_cvref_t<decltype(state(0))>;
+
+    return vector<type, 3>{state(0) * state(1),
+                           sin(state(0)) + state(1) * state(1),
+                           3.0 * exp(state(0)) / state(1)};
+  }};
+
+  const matrix<double, 3, 2> expected{
+      {2.0, 0.5},
+      {std::cos(0.5), 4.0},
+      {3.0 * std::exp(0.5) / 2.0, -3.0 * std::exp(0.5) / 4.0}};
+
+  assert(near(jacobian(nonlinear, x), expected));
+
+  const matrix<double, 2, 2> f{{1.0, 0.1}, {0.0, 1.0}};
+
+  assert(near(jacobian([&f](const auto &state) { return f * state; }, x), f));
+
+  static_assert(
+      std::is_same_v<decltype(jacobian(nonlinear, x)), matrix<double, 3, 2>>);
+
+  const typed_matrix<eigen::matrix<double, 2, 1>, lengths, unit> y{
+      eigen::matrix<double, 2, 1>{0.5, 2.0}};
+  const typed_matrix<eigen::matrix<double, 2, 2>, lengths, lengths> p{
+      eigen::matrix<double, 2, 2>{{4.0, 1.0}, {1.0, 3.0}}};
+
+  const auto h{jacobian(
+      [](const auto &state) {
+        using type = typename std::remove_cvref_t<decltype(state)>::underlying;
+
+        return typed_matrix<eigen::matrix<type, 2, 1>, per_lengths, unit>{
+            eigen::matrix<type, 2, 1>{state.data(0, 0) * state.data(1, 0),
+                                      2.0 * state.data(1, 0)}};
+      },
+      y)};
+  const auto hy{h * y};
+  const auto s{h * p * transpose(h)};
+
+  static_assert(
+      std::is_same_v<decltype(hy),
+                     const typed_matrix<eigen::matrix<double, 2, 1>,
+                                        per_lengths, unit>>);
+  static_assert(
+      std::is_same_v<decltype(s),
+                     const typed_matrix<eigen::matrix<double, 2, 2>,
+                                        per_lengths, per_lengths>>);
+
+  const matrix<double, 2, 2> dh{{2.0, 0.5}, {0.0, 2.0}};
+  const matrix<double, 2, 2> dp{p.data};
+  const matrix<double, 2, 1> dy{y.data};
+
+  assert(near(matrix<double, 2, 1>{hy.data}, dh * dy));
+  assert(near(matrix<double, 2, 2>{s.data}, dh * dp * transpose(dh)));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,72 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the Kronecker product elements, the lazy Kronecker products
+//! against their dense equivalents, and the vectorization identity.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 2, 3> a{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const matrix<double, 2, 2> b{{0.5, -1.0}, {2.0, 0.25}};
+  const matrix<double, 4, 6> k{kronecker(a, b)};
+
+  assert(k(0, 0) == 0.5 && k(0, 1) == -1.0 && k(1, 0) == 2.0);
+  assert(k(0, 2) == 1.0 && k(1, 5) == 0.75 && k(3, 4) == 12.0);
+  assert(k(2, 0) == 2.0 && k(3, 5) == 1.5);
+
+  const auto lazy{lazy_kronecker(a, b)};
+  const matrix<double, 4, 6> dense{lazy};
+
+  assert(dense == k);
+
+  const matrix<double, 6, 1> x{1.0, -2.0, 0.5, 3.0, -1.0, 2.0};
+  const matrix<double, 6, 2> y{{1.0, 2.0},  {3.0, 4.0}, {5.0, 6.0},
+                               {-7.0, 8.0}, {9.0, 1.0}, {2.0, -3.0}};
+
+  assert(near(lazy * x, k * x));
+  assert(near(lazy * y, k * y));
+
+  const matrix<double, 2, 3> z{{1.0, -2.0, 3.0}, {0.5, 4.0, -1.0}};
+  const auto v{vec(z)};
+
+  assert(v(1, 0) == 0.5 && v(2, 0) == -2.0 && v(5, 0) == -1.0);
+  assert(near(lazy * v, vec(b * z * transpose(a))));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
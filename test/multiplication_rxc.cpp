@@ -35,15 +35,14 @@ For more information, please refer to <https://unlicense.org> */
 
 namespace fcarouge::test {
 namespace {
-//! @test Verifies the row by column multiplication operator.
-//!
-//! @todo Should this edge case decay to the underlying type?
+//! @test Verifies the row by column multiplication operator decays to the
+//! element type.
 [[maybe_unused]] auto test{[] {
   const matrix<double, 1, 2> a{1.0, 2.0};
   const matrix<double, 2, 1> b{3.0, 4.0};
-  const matrix<double, 1, 1> r{a * b};
+  const double r{a * b};
 
-  assert(r(0, 0) == 11.0);
+  assert(r == 11.0);
 
   return 0;
 }()};
@@ -0,0 +1,63 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the typed reductions and their result types.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 3, 3> p{
+      {4.0, 2.0, 0.4}, {2.0, 5.0, 1.0}, {0.4, 1.0, 3.0}};
+  const column_vector<double, 3> y{3.0, -4.0, 12.0};
+  const column_vector<double, 3> z{1.0, 2.0, 3.0};
+
+  static_assert(std::is_same_v<decltype(trace(p)), double>);
+  static_assert(std::is_same_v<decltype(dot(y, z)), double>);
+
+  assert(trace(p) == 12.0);
+  assert(sum(p) == 18.8);
+  assert(min(p) == 0.4);
+  assert(max(p) == 5.0);
+  assert(dot(y, z) == 31.0);
+  assert(squared_norm(y) == 169.0);
+  assert(norm(y) == 13.0);
+  assert(min(y) == -4.0);
+  assert(std::abs(dot(y, p * y) - transpose(y) * p * y) < 1e-12);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,86 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the incremental window mean and covariance of the ring
+//! buffer against their direct computations over the window.
+[[maybe_unused]] auto test{[] {
+  typed_ring_buffer<column_vector<double, 2>, 4> window;
+
+  assert(window.empty());
+  assert(window.capacity() == 4);
+  assert(near(window.covariance(),
+              matrix<double, 2, 2>{{0.0, 0.0}, {0.0, 0.0}}));
+
+  for (std::size_t k{0}; k < 11; ++k) {
+    const double t{static_cast<double>(k)};
+
+    window.push(column_vector<double, 2>{std::sin(t) + t, t * t / 10.0});
+
+    column_vector<double, 2> mean{0.0, 0.0};
+
+    for (std::size_t i{0}; i < window.size(); ++i) {
+      mean = mean + window[i] / static_cast<double>(window.size());
+    }
+
+    matrix<double, 2, 2> covariance{{0.0, 0.0}, {0.0, 0.0}};
+
+    for (std::size_t i{0}; window.size() > 1 && i < window.size(); ++i) {
+      covariance = covariance + (window[i] - mean) *
+                                    transpose(window[i] - mean) /
+                                    static_cast<double>(window.size() - 1);
+    }
+
+    assert(window.size() == (k < 4 ? k + 1 : 4));
+    assert(window.back() == (column_vector<double, 2>{std::sin(t) + t,
+                                                      t * t / 10.0}));
+    assert(near(window.mean(), mean));
+    assert(near(window.covariance(), covariance));
+  }
+
+  assert(window.full());
+
+  window.clear();
+
+  assert(window.empty());
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,115 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <tuple>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+//! @brief A length index type of the given count of meters per unit.
+template <int Meters> struct length {
+  double value;
+};
+
+template <int Meters1, int Meters2>
+double operator*(length<Meters1> lhs, length<Meters2> rhs);
+
+template <int Meters> double operator/(int lhs, length<Meters> rhs);
+
+using meter = length<1>;
+using kilometer = length<1000>;
+} // namespace
+} // namespace fcarouge::test
+
+template <int From, int To>
+struct fcarouge::typed_linear_algebra_internal::scales<
+    fcarouge::test::length<From>, fcarouge::test::length<To>> {
+  [[nodiscard]] inline constexpr double operator()() const {
+    return static_cast<double>(From) / To;
+  }
+};
+
+namespace fcarouge::test {
+namespace {
+template <typename RowIndexes, typename ColumnIndexes>
+using typed = typed_matrix<eigen::matrix<double, 2, tla::size<ColumnIndexes>>,
+                           RowIndexes, ColumnIndexes>;
+
+//! @test Verifies the compile-time scale conversions of the typed matrices and
+//! the products of typed matrices of compatible inner scales.
+[[maybe_unused]] auto test{[] {
+  using meters = std::tuple<meter, meter>;
+  using mixed = std::tuple<kilometer, meter>;
+
+  static_assert(tla::scalable_indexes<mixed, meters>);
+  static_assert(!tla::scalable_indexes<mixed, std::tuple<meter>>);
+  static_assert(tla::scale_factors<mixed, meters>[0] == 1000.0);
+  static_assert(tla::scale_factors<meters, mixed>[0] == 0.001);
+
+  const typed<mixed, tla::identity_index> x{1.5, 20.0};
+  const auto y{convert<typed<meters, tla::identity_index>>(x)};
+
+  assert(y.data(0) == 1500.0 && y.data(1) == 20.0);
+  assert((convert<typed<mixed, tla::identity_index>>(y).data == x.data));
+
+  typed<mixed, mixed> p;
+  p.data << 1.0, 2.0, 3.0, 4.0;
+
+  const auto q{convert<typed<meters, meters>>(p)};
+
+  assert(q.data(0, 0) == 1000000.0 && q.data(0, 1) == 2000.0);
+  assert(q.data(1, 0) == 3000.0 && q.data(1, 1) == 4.0);
+
+  typed<meters, meters> f;
+  f.data << 1.0, 0.5, 0.0, 1.0;
+
+  const auto z{f * x};
+
+  static_assert(
+      std::is_same_v<decltype(z), const typed<meters, tla::identity_index>>);
+  assert(z.data == (f * y).data);
+
+  typed<meters, meters> g;
+  g.data << 1.0, 2.0, 3.0, 4.0;
+  typed<mixed, meters> h;
+  h.data << 0.001, 0.002, 3.0, 4.0;
+
+  assert((g * convert<typed<meters, meters>>(h)).data == (g * h).data);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,77 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+template <typename TypedMatrix>
+concept has_identity = requires { identity<TypedMatrix>(); };
+
+//! @test Verifies the identity and zero expressions simplify at compile time,
+//! the identities being square.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 3, 2> a{{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}};
+  const auto i3{identity<matrix<double, 3, 3>>()};
+  const auto i2{identity<matrix<double, 2, 2>>()};
+  const auto z32{zero<matrix<double, 3, 2>>()};
+  const auto z23{zero<matrix<double, 2, 3>>()};
+
+  static_assert(!has_identity<matrix<double, 3, 2>>);
+  static_assert(std::is_same_v<decltype(i3 * a), matrix<double, 3, 2>>);
+  static_assert(std::is_same_v<decltype(a * i2), matrix<double, 3, 2>>);
+  static_assert(std::is_same_v<decltype(i3 * i3),
+                               identity_matrix<matrix<double, 3, 3>>>);
+  static_assert(
+      std::is_same_v<decltype(z23 * a), zero_matrix<matrix<double, 2, 2>>>);
+  static_assert(
+      std::is_same_v<decltype(a * z23), zero_matrix<matrix<double, 3, 3>>>);
+
+  assert(i3 * a == a);
+  assert(a * i2 == a);
+  assert(a + z32 == a);
+  assert(z32 + a == a);
+  assert(a - z32 == a);
+
+  const matrix<double, 2, 2> z{z23 * a};
+
+  assert(z(0, 0) == 0.0);
+  assert(z(0, 1) == 0.0);
+  assert(z(1, 0) == 0.0);
+  assert(z(1, 1) == 0.0);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,128 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace fcarouge::test {
+namespace {
+//! @brief A matrix of the same value for every element.
+matrix<double, 3, 3> uniform(double value) {
+  matrix<double, 3, 3> result;
+
+  for (std::size_t i{0}; i < 3; ++i) {
+    for (std::size_t j{0}; j < 3; ++j) {
+      result(i, j) = value;
+    }
+  }
+
+  return result;
+}
+
+//! @test Verifies the copies of the snapshots share their storage, the
+//! publications leave the acquired storages unchanged, and the readers acquire
+//! the whole freshest publication while the writer publishes concurrently.
+[[maybe_unused]] auto test{[] {
+  typed_snapshot<matrix<double, 2, 2>> writer{
+      matrix<double, 2, 2>{{1.0, 2.0}, {3.0, 4.0}}};
+  const column_vector<double, 2> x{1.0, 1.0};
+  const typed_snapshot<matrix<double, 2, 2>> copy{writer};
+  const auto reader{copy.acquire()};
+
+  assert(reader == writer.acquire());
+  assert(*reader * x == (column_vector<double, 2>{3.0, 7.0}));
+  assert((reader->at<1, 0>() == 3.0));
+
+  writer.update([](matrix<double, 2, 2> &value) { value.at<1, 0>() = 5.0; });
+
+  assert(writer.acquire() != reader);
+  assert((reader->at<1, 0>() == 3.0));
+  assert((copy.acquire()->at<1, 0>() == 3.0));
+  assert((writer.acquire()->at<1, 0>() == 5.0));
+  assert((writer.acquire()->at<0, 1>() == 2.0));
+
+  writer.publish(matrix<double, 2, 2>{{0.0, 0.0}, {0.0, 0.0}});
+
+  assert((writer.acquire()->at<1, 0>() == 0.0));
+  assert((reader->at<1, 0>() == 3.0));
+
+  const typed_snapshot<matrix<double, 2, 2>> moved{std::move(writer)};
+
+  assert((moved.acquire()->at<1, 0>() == 0.0));
+
+  typed_snapshot<matrix<double, 3, 3>> snapshot{uniform(0.0)};
+  constexpr double publications{20000.0};
+  std::atomic<bool> done{false};
+  std::vector<std::thread> readers;
+
+  for (std::size_t k{0}; k < 3; ++k) {
+    readers.emplace_back([&snapshot, &done] {
+      double previous{0.0};
+
+      while (!done.load(std::memory_order_acquire)) {
+        const std::shared_ptr<const matrix<double, 3, 3>> value{
+            snapshot.acquire()};
+        const double first{(*value)(0, 0)};
+
+        assert(first >= previous);
+        assert(*value == uniform(first));
+
+        previous = first;
+      }
+    });
+  }
+
+  for (double k{1.0}; k <= publications; k += 1.0) {
+    if (static_cast<std::size_t>(k) % 2 == 0) {
+      snapshot.publish(uniform(k));
+    } else {
+      snapshot.update([k](matrix<double, 3, 3> &value) { value = uniform(k); });
+    }
+  }
+
+  done.store(true, std::memory_order_release);
+
+  for (auto &thread : readers) {
+    thread.join();
+  }
+
+  assert(*snapshot.acquire() == uniform(publications));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,74 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the horizontal and vertical concatenations, their index
+//! types, and the lazy concatenation into a preallocated destination.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 2, 3> h1{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const matrix<double, 1, 3> h2{7.0, 8.0, 9.0};
+  const column_vector<double, 2> z1{1.0, 2.0};
+  const column_vector<double, 1> z2{3.0};
+
+  const auto h{vstack(h1, h2)};
+  const auto z{vstack(z1, z2)};
+  const auto a{hstack(h1, z1, z1)};
+
+  static_assert(std::is_same_v<decltype(h), const matrix<double, 3, 3>>);
+  static_assert(std::is_same_v<decltype(z), const column_vector<double, 3>>);
+  static_assert(std::is_same_v<decltype(a), const matrix<double, 2, 5>>);
+
+  assert(h == (matrix<double, 3, 3>{
+                  {1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}, {7.0, 8.0, 9.0}}));
+  assert(z == (column_vector<double, 3>{1.0, 2.0, 3.0}));
+  assert(a == (matrix<double, 2, 5>{{1.0, 2.0, 3.0, 1.0, 1.0},
+                                    {4.0, 5.0, 6.0, 2.0, 2.0}}));
+
+  matrix<double, 3, 3> destination;
+
+  stack<stacking::vertical>(h1, h2).assign_to(destination);
+
+  assert(destination == h);
+
+  const matrix<double, 3, 3> converted{stack<stacking::vertical>(h1, h2)};
+
+  assert(converted == h);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,78 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the row-major storage order of the matrices, contiguous rows
+//! and mixed order operations. The stackings and products of row-major
+//! matrices are row-major.
+[[maybe_unused]] auto test{[] {
+  using row_major = matrix<double, 2, 3, storage_order::row_major>;
+  using column_major = matrix<double, 2, 3>;
+
+  const row_major r{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const column_major c{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+
+  assert(r.data.data()[1] == 2.0);
+  assert(c.data.data()[1] == 4.0);
+  assert(r == c);
+  assert(r * transpose(c) == c * transpose(c));
+  assert(r + c == c + c);
+  assert(transpose(r) * c == transpose(c) * c);
+
+  const column_major copy{r};
+
+  assert(copy == c);
+
+  using jacobian = matrix<double, 1, 300, storage_order::column_major>;
+
+  static_assert(decltype(jacobian::data)::IsRowMajor);
+
+  const auto stacked{vstack(r, r)};
+  const auto juxtaposed{hstack(r, r)};
+  const auto product{kronecker(r, r)};
+
+  static_assert(decltype(stacked.data)::IsRowMajor);
+  static_assert(decltype(juxtaposed.data)::IsRowMajor);
+  static_assert(decltype(product.data)::IsRowMajor);
+  static_assert(!decltype(vstack(c, c).data)::IsRowMajor);
+  static_assert(!decltype(vec(r).data)::IsRowMajor);
+  assert(stacked(3, 2) == 6.0 && juxtaposed(1, 4) == 5.0);
+  assert(product(1, 5) == r(0, 1) * r(1, 2));
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
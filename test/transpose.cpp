@@ -0,0 +1,66 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+
+#include <cassert>
+#include <type_traits>
+
+namespace fcarouge::test {
+namespace {
+//! @test Verifies the transposition and its double transposition
+//! simplification.
+[[maybe_unused]] auto test{[] {
+  const matrix<double, 2, 3> a{{1.0, 2.0, 3.0}, {4.0, 5.0, 6.0}};
+  const matrix<double, 3, 2> t{transpose(a)};
+
+  assert(t(0, 0) == 1.0);
+  assert(t(0, 1) == 4.0);
+  assert(t(1, 0) == 2.0);
+  assert(t(1, 1) == 5.0);
+  assert(t(2, 0) == 3.0);
+  assert(t(2, 1) == 6.0);
+
+  static_assert(
+      std::is_same_v<decltype(transpose(transpose(a))), matrix<double, 2, 3>>);
+  assert(transpose(transpose(a)) == a);
+
+  const matrix<double, 2, 2> r{a * transpose(a)};
+
+  assert(r(0, 0) == 14.0);
+  assert(r(0, 1) == 32.0);
+  assert(r(1, 0) == 32.0);
+  assert(r(1, 1) == 77.0);
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test
@@ -0,0 +1,92 @@
+/* Typed Linear Algebra
+Version 0.1.0
+https://github.com/FrancoisCarouge/TypedLinearAlgebra
+
+SPDX-License-Identifier: Unlicense
+
+This is free and unencumbered software released into the public domain.
+
+Anyone is free to copy, modify, publish, use, compile, sell, or
+distribute this software, either in source code form or as a compiled
+binary, for any purpose, commercial or non-commercial, and by any
+means.
+
+In jurisdictions that recognize copyright laws, the author or authors
+of this software dedicate any and all copyright interest in the
+software to the public domain. We make this dedication for the benefit
+of the public at large and to the detriment of our heirs and
+successors. We intend this dedication to be an overt act of
+relinquishment in perpetuity of all present and future rights to this
+software under copyright law.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+IN NO EVENT SHALL THE AUTHORS BE LIABLE FOR ANY CLAIM, DAMAGES OR
+OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE,
+ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+OTHER DEALINGS IN THE SOFTWARE.
+
+For more information, please refer to <https://unlicense.org> */
+
+#include "fcarouge/linalg.hpp"
+#include "near.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace fcarouge::test {
+namespace {
+namespace tla = typed_linear_algebra_internal;
+
+template <typename Covariance>
+concept spreadable = requires(unscented_transform<double, 3> transform,
+                              column_vector<double, 3> mean,
+                              Covariance covariance) {
+  sigma_points(transform, mean, covariance);
+};
+
+//! @test Verifies the unscented transform of a linear model propagated as one
+//! batched product recovers the exact propagated mean and covariance. The
+//! covariance that is not positive definite yields no sigma points. The
+//! covariance is square and indexed by the rows of the state.
+[[maybe_unused]] auto test{[] {
+  const column_vector<double, 3> x{1.0, -2.0, 0.5};
+  const matrix<double, 3, 3> p{
+      {4.0, 2.0, 0.4}, {2.0, 5.0, 1.0}, {0.4, 1.0, 3.0}};
+  const matrix<double, 2, 3> h{{1.0, 0.1, 0.0}, {0.0, 1.0, 2.0}};
+
+  static_assert(spreadable<matrix<double, 3, 3>>);
+  static_assert(!spreadable<matrix<double, 3, 2>>);
+  static_assert(
+      !spreadable<typed_matrix<eigen::matrix<double, 3, 3>,
+                               tla::tuple_n_type<double, 3>,
+                               tla::tuple_n_type<float, 3>>>);
+
+  const unscented_transform<double, 3> standard;
+  const unscented_transform<double, 3> scaled{.alpha = 1e-1, .beta = 2.0};
+
+  for (const auto &transform : {standard, scaled}) {
+    const auto sigmas{*sigma_points(transform, x, p)};
+
+    static_assert(decltype(sigmas)::columns == 7);
+
+    assert(sigmas(0, 0) == x(0));
+    assert(sigmas(2, 0) == x(2));
+
+    const auto [mean, covariance]{recombine(transform, sigmas)};
+
+    assert(near(mean, x, 1e-9));
+    assert(near(covariance, p, 1e-9));
+
+    const auto [z, s]{recombine(transform, h * sigmas)};
+
+    assert(near(z, h * x, 1e-9));
+    assert(near(s, h * p * transpose(h), 1e-9));
+    assert(!sigma_points(transform, x, -1.0 * p));
+  }
+
+  return 0;
+}()};
+} // namespace
+} // namespace fcarouge::test